@@ -0,0 +1,426 @@
+#include "convex_hull.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Number of heap allocations made by the process, sampled around every call to report allocations per call
+std::atomic<long long> number_of_allocations{0};
+} // namespace
+
+// Every replaceable allocation function is replaced, so that allocations of over-aligned and nothrow forms are counted
+// too and each one is released by its matching deallocation function. The array forms forward to these by default.
+// The functions that call malloc and free are kept out of line, so that inlining them into the callers does not pair a
+// malloc with operator delete or operator new with free.
+__attribute__((noinline)) void *operator new(std::size_t size)
+{
+    number_of_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    number_of_allocations.fetch_add(1, std::memory_order_relaxed);
+    // std::aligned_alloc requires the size to be a multiple of the alignment
+    const auto alignment_bytes = static_cast<std::size_t>(alignment);
+    const std::size_t aligned_size =
+        (std::max<std::size_t>(size, 1) + alignment_bytes - 1) / alignment_bytes * alignment_bytes;
+    if (void *ptr = std::aligned_alloc(alignment_bytes, aligned_size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return ::operator new(size);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return nullptr;
+    }
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return ::operator new(size, alignment);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return nullptr;
+    }
+}
+
+__attribute__((noinline)) void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    ::operator delete(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void *ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+    ::operator delete(ptr, alignment);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    ::operator delete(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    ::operator delete(ptr, alignment);
+}
+
+namespace
+{
+using namespace geom;
+
+/// @brief Point distributions of the benchmark, each generated with its own fixed seed
+enum class PointDistribution
+{
+    UNIFORM_SQUARE,
+    UNIFORM_DISK,
+    CIRCLE,
+    GAUSSIAN,
+    CLUSTERED,
+    INTEGER_GRID,
+    STAR_POLYGON // Uniform disk points ordered by angle around the center, which form a simple polygon
+};
+
+const char *getName(PointDistribution distribution)
+{
+    switch (distribution)
+    {
+    case PointDistribution::UNIFORM_SQUARE:
+        return "uniform_square";
+    case PointDistribution::UNIFORM_DISK:
+        return "uniform_disk";
+    case PointDistribution::CIRCLE:
+        return "circle";
+    case PointDistribution::GAUSSIAN:
+        return "gaussian";
+    case PointDistribution::CLUSTERED:
+        return "clustered";
+    case PointDistribution::INTEGER_GRID:
+        return "integer_grid";
+    default:
+        return "star_polygon";
+    }
+}
+
+const char *getName(ConvexHullAlgorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case ConvexHullAlgorithm::GRAHAM_SCAN:
+        return "GRAHAM_SCAN";
+    case ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN:
+        return "ANDREW_MONOTONE_CHAIN";
+    case ConvexHullAlgorithm::JARVIS_MARCH:
+        return "JARVIS_MARCH";
+    case ConvexHullAlgorithm::CHAN:
+        return "CHAN";
+    case ConvexHullAlgorithm::PARALLEL_ANDREW_MONOTONE_CHAIN:
+        return "PARALLEL_ANDREW_MONOTONE_CHAIN";
+    case ConvexHullAlgorithm::QUICKHULL:
+        return "QUICKHULL";
+    case ConvexHullAlgorithm::PARALLEL_QUICKHULL:
+        return "PARALLEL_QUICKHULL";
+    case ConvexHullAlgorithm::MELKMAN:
+        return "MELKMAN";
+    case ConvexHullAlgorithm::APPROXIMATE:
+        return "APPROXIMATE";
+    default:
+        return "AUTO";
+    }
+}
+
+/// @brief Generates n points of the given distribution, identical across runs and commits
+std::vector<Point<double>> generatePoints(PointDistribution distribution, long long n)
+{
+    std::mt19937_64 generator(12345 + static_cast<int>(distribution));
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    const double pi = std::acos(-1.0);
+
+    // Clusters are centered at fixed positions drawn before the points
+    std::vector<Point<double>> centers;
+    for (int i = 0; i < 32; ++i)
+    {
+        centers.emplace_back(1000.0 * uniform(generator), 1000.0 * uniform(generator));
+    }
+
+    // Angles of the star polygon are sorted before its points are placed, so that they are visited in order
+    std::vector<double> angles;
+    if (distribution == PointDistribution::STAR_POLYGON)
+    {
+        angles.resize(n);
+        for (auto &angle : angles)
+        {
+            angle = 2.0 * pi * uniform(generator);
+        }
+        std::sort(angles.begin(), angles.end());
+    }
+
+    std::vector<Point<double>> points;
+    points.reserve(n);
+    for (long long i = 0; i < n; ++i)
+    {
+        switch (distribution)
+        {
+        case PointDistribution::UNIFORM_SQUARE:
+            points.emplace_back(1000.0 * uniform(generator), 1000.0 * uniform(generator));
+            break;
+        case PointDistribution::UNIFORM_DISK: {
+            const double radius = 500.0 * std::sqrt(uniform(generator));
+            const double angle = 2.0 * pi * uniform(generator);
+            points.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+            break;
+        }
+        case PointDistribution::CIRCLE: {
+            const double angle = 2.0 * pi * uniform(generator);
+            points.emplace_back(500.0 * std::cos(angle), 500.0 * std::sin(angle));
+            break;
+        }
+        case PointDistribution::GAUSSIAN:
+            points.emplace_back(100.0 * normal(generator), 100.0 * normal(generator));
+            break;
+        case PointDistribution::CLUSTERED: {
+            const auto &center = centers[generator() % centers.size()];
+            points.emplace_back(center.x + 10.0 * normal(generator), center.y + 10.0 * normal(generator));
+            break;
+        }
+        case PointDistribution::INTEGER_GRID:
+            points.emplace_back(static_cast<double>(generator() % 1024), static_cast<double>(generator() % 1024));
+            break;
+        case PointDistribution::STAR_POLYGON: {
+            const double radius = 500.0 * std::sqrt(uniform(generator));
+            points.emplace_back(radius * std::cos(angles[i]), radius * std::sin(angles[i]));
+            break;
+        }
+        }
+    }
+    return points;
+}
+
+/// @brief Returns points of the given distribution and size. Only the most recent set is kept, since benchmarks are
+/// registered so that consecutive ones share their input.
+const std::vector<Point<double>> &getPoints(PointDistribution distribution, long long n)
+{
+    static PointDistribution cached_distribution = PointDistribution::UNIFORM_SQUARE;
+    static std::vector<Point<double>> cached_points;
+    if (cached_distribution != distribution || static_cast<long long>(cached_points.size()) != n)
+    {
+        cached_points.clear();
+        cached_points.shrink_to_fit();
+        cached_points = generatePoints(distribution, n);
+        cached_distribution = distribution;
+    }
+    return cached_points;
+}
+
+/// @brief Benchmarks one hull construction per iteration, either through the value API or through a reused workspace
+void benchmarkConvexHull(benchmark::State &state, ConvexHullAlgorithm algorithm, PointDistribution distribution,
+                         bool use_workspace, ConvexHullFilter filter)
+{
+    const long long n = state.range(0);
+    const auto &points = getPoints(distribution, n);
+    ConvexHullWorkspace<double> workspace;
+    std::vector<int> hull_indices;
+
+    long long allocations = 0;
+    for (auto _ : state)
+    {
+        const long long allocations_before = number_of_allocations.load(std::memory_order_relaxed);
+        if (use_workspace)
+        {
+            constructConvexHull(points, hull_indices, workspace, algorithm, Orientation::COUNTERCLOCKWISE,
+                                ConvexHullReturnType::OPEN, filter);
+        }
+        else
+        {
+            hull_indices =
+                constructConvexHull(points, algorithm, Orientation::COUNTERCLOCKWISE, ConvexHullReturnType::OPEN, filter);
+        }
+        allocations += number_of_allocations.load(std::memory_order_relaxed) - allocations_before;
+        benchmark::DoNotOptimize(hull_indices.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * n);
+    state.counters["allocations_per_call"] =
+        benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    state.counters["hull_size"] = static_cast<double>(hull_indices.size());
+}
+
+/// @brief Benchmarks the std::array overload on 4096 sets of N uniform points per iteration
+template <std::size_t N> void benchmarkFixedConvexHull(benchmark::State &state)
+{
+    const auto &points = getPoints(PointDistribution::UNIFORM_SQUARE, 4096 * N);
+    std::vector<std::array<Point<double>, N>> point_sets(4096);
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        point_sets[i / N][i % N] = points[i];
+    }
+
+    std::size_t hull_size = 0;
+    for (auto _ : state)
+    {
+        for (const auto &point_set : point_sets)
+        {
+            const auto hull_indices = constructConvexHull(point_set);
+            hull_size += hull_indices.size();
+            benchmark::DoNotOptimize(hull_indices);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(point_sets.size()));
+    state.counters["hull_size"] =
+        static_cast<double>(hull_size) / static_cast<double>(state.iterations() * point_sets.size());
+}
+
+/// @brief Benchmarks merging the precomputed hulls of number_of_sets consecutive sets of n points of the distribution
+void benchmarkMergeConvexHulls(benchmark::State &state, PointDistribution distribution)
+{
+    const long long n = state.range(0);
+    const int number_of_sets = static_cast<int>(state.range(1));
+    const auto &points = getPoints(distribution, n);
+    std::vector<int> offsets;
+    for (int set_no = 0; set_no <= number_of_sets; ++set_no)
+    {
+        offsets.push_back(static_cast<int>(n * set_no / number_of_sets));
+    }
+    std::vector<int> hull_indices, hull_offsets;
+    constructConvexHulls(points, offsets, hull_indices, hull_offsets);
+
+    ConvexHullWorkspace<double> workspace;
+    std::vector<int> merged_hull_indices;
+    for (auto _ : state)
+    {
+        mergeConvexHulls(points, hull_indices, hull_offsets, merged_hull_indices, workspace);
+        benchmark::DoNotOptimize(merged_hull_indices.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(hull_indices.size()));
+    state.counters["hull_size"] = static_cast<double>(merged_hull_indices.size());
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    // Largest input size, 10^8 by default, can be lowered with CONVEX_HULL_BENCH_MAX_N
+    long long max_n = 100'000'000;
+    if (const char *value = std::getenv("CONVEX_HULL_BENCH_MAX_N"))
+    {
+        max_n = std::atoll(value);
+    }
+
+    const PointDistribution distributions[] = {PointDistribution::UNIFORM_SQUARE, PointDistribution::UNIFORM_DISK,
+                                               PointDistribution::CIRCLE,         PointDistribution::GAUSSIAN,
+                                               PointDistribution::CLUSTERED,      PointDistribution::INTEGER_GRID,
+                                               PointDistribution::STAR_POLYGON};
+    const ConvexHullAlgorithm algorithms[] = {
+        ConvexHullAlgorithm::GRAHAM_SCAN, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN,
+        ConvexHullAlgorithm::JARVIS_MARCH, ConvexHullAlgorithm::CHAN,
+        ConvexHullAlgorithm::PARALLEL_ANDREW_MONOTONE_CHAIN, ConvexHullAlgorithm::QUICKHULL,
+        ConvexHullAlgorithm::PARALLEL_QUICKHULL, ConvexHullAlgorithm::MELKMAN, ConvexHullAlgorithm::APPROXIMATE,
+        ConvexHullAlgorithm::AUTO};
+
+    // Register benchmarks grouped by input, so that every point set is generated once
+    for (const auto distribution : distributions)
+    {
+        for (long long n = 10; n <= max_n; n *= 10)
+        {
+            for (const auto algorithm : algorithms)
+            {
+                // Jarvis March takes O(n h) time, which is quadratic when every point is a hull vertex
+                if (algorithm == ConvexHullAlgorithm::JARVIS_MARCH && distribution == PointDistribution::CIRCLE &&
+                    n > 10'000)
+                {
+                    continue;
+                }
+
+                // Melkman's algorithm requires points in the order of a simple polyline or polygon
+                if (algorithm == ConvexHullAlgorithm::MELKMAN && distribution != PointDistribution::STAR_POLYGON)
+                {
+                    continue;
+                }
+
+                for (const bool use_workspace : {false, true})
+                {
+                    const std::string name = std::string(getName(algorithm)) + "/" + getName(distribution) +
+                                             (use_workspace ? "/workspace" : "/value");
+                    benchmark::RegisterBenchmark(name.c_str(), benchmarkConvexHull, algorithm, distribution,
+                                                 use_workspace, ConvexHullFilter::NONE)
+                        ->Arg(n)
+                        ->Unit(benchmark::kMicrosecond);
+                }
+
+                // Sorting algorithms are run on the survivors of the octagon filter too, which are fewer and lie near
+                // the hull, so that the sort paths are measured on the input sizes they see in filtered pipelines
+                if (algorithm == ConvexHullAlgorithm::GRAHAM_SCAN ||
+                    algorithm == ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN || algorithm == ConvexHullAlgorithm::CHAN)
+                {
+                    const std::string name =
+                        std::string(getName(algorithm)) + "/" + getName(distribution) + "/workspace_octagon";
+                    benchmark::RegisterBenchmark(name.c_str(), benchmarkConvexHull, algorithm, distribution, true,
+                                                 ConvexHullFilter::OCTAGON)
+                        ->Arg(n)
+                        ->Unit(benchmark::kMicrosecond);
+                }
+            }
+        }
+    }
+
+    // Fixed-size sets, such as box corners and contact points
+    benchmark::RegisterBenchmark("FIXED/4", benchmarkFixedConvexHull<4>)->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark("FIXED/8", benchmarkFixedConvexHull<8>)->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark("FIXED/16", benchmarkFixedConvexHull<16>)->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark("FIXED/32", benchmarkFixedConvexHull<32>)->Unit(benchmark::kMicrosecond);
+
+    // Hulls of the union of precomputed tile hulls
+    for (const auto distribution : {PointDistribution::UNIFORM_SQUARE, PointDistribution::CIRCLE})
+    {
+        const std::string name = std::string("MERGE/") + getName(distribution);
+        benchmark::RegisterBenchmark(name.c_str(), benchmarkMergeConvexHulls, distribution)
+            ->Args({std::min<long long>(max_n, 1'000'000), 16})
+            ->Args({std::min<long long>(max_n, 1'000'000), 1024})
+            ->Unit(benchmark::kMicrosecond);
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
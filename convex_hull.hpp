@@ -2,14 +2,79 @@
 #define CONVEX_HULL_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <numeric>
+#include <random>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <variant>
 #include <vector>
 
+// Batched kernels use AVX2 / AVX-512 on x86 when supported by the running CPU, selected at runtime
+#if !defined(CONVEX_HULL_DISABLE_SIMD) && (defined(__GNUC__) || defined(__clang__)) &&                             \
+    (defined(__x86_64__) || defined(__i386__))
+#define CONVEX_HULL_X86_SIMD 1
+#include <immintrin.h>
+#if defined(__clang__)
+#define CONVEX_HULL_TARGET(isa) __attribute__((target(isa)))
+#else
+// Keep multiplications and subtractions separate, so that SIMD results are identical to scalar ones
+#define CONVEX_HULL_TARGET(isa) __attribute__((target(isa), optimize("fp-contract=off")))
+#endif
+#else
+#define CONVEX_HULL_X86_SIMD 0
+#endif
+
+// Orientation tests of floating-point points are exact, using an error-bounded floating-point filter with an exact
+// fallback, unless CONVEX_HULL_FAST_PREDICATES is defined to use the plain floating-point cross product
+#if defined(CONVEX_HULL_FAST_PREDICATES)
+#define CONVEX_HULL_ROBUST_PREDICATES 0
+#else
+#define CONVEX_HULL_ROBUST_PREDICATES 1
+#endif
+
+// Predicates evaluated at compile time avoid std::fabs and std::fma, which are not constexpr before C++23; compilers
+// without the builtin evaluate floating-point predicates at compile time only if they fold those functions
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define CONVEX_HULL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(CONVEX_HULL_IS_CONSTANT_EVALUATED)
+#define CONVEX_HULL_IS_CONSTANT_EVALUATED() false
+#endif
+
+// Per-stage timings and counters are collected into ConvexHullStats only if CONVEX_HULL_ENABLE_STATS is defined,
+// otherwise the instrumentation compiles to nothing and the hull pipeline is unchanged
+#if defined(CONVEX_HULL_ENABLE_STATS)
+#define CONVEX_HULL_STATS 1
+#define CONVEX_HULL_STAGE(stage) ::geom::beginConvexHullStage(::geom::ConvexHullStage::stage)
+#define CONVEX_HULL_COUNT(counter, count) ::geom::addConvexHullCount(&::geom::ConvexHullStats::counter, count)
+#define CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, algorithm, number_of_points)                                 \
+    ::geom::ConvexHullStatsScope convex_hull_stats_scope(workspace, hull_indices, algorithm, number_of_points)
+#else
+#define CONVEX_HULL_STATS 0
+#define CONVEX_HULL_STAGE(stage) ((void)0)
+#define CONVEX_HULL_COUNT(counter, count) ((void)0)
+#define CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, algorithm, number_of_points) static_cast<void>(workspace)
+#endif
+
 namespace geom
 {
 /// @brief Class that stores orientation formed by three 2D points
@@ -26,7 +91,13 @@ enum class ConvexHullAlgorithm
     GRAHAM_SCAN,
     ANDREW_MONOTONE_CHAIN,
     JARVIS_MARCH,
-    CHAN
+    CHAN,
+    PARALLEL_ANDREW_MONOTONE_CHAIN,
+    QUICKHULL,
+    PARALLEL_QUICKHULL,
+    MELKMAN,     // Requires points in the order of a simple polyline or polygon
+    APPROXIMATE, // Hull of a subset of the points in O(n), see ConvexHullWorkspace::approximation_error
+    AUTO         // Selects algorithm and filter from the input, see ConvexHullAutoThresholds
 };
 
 /// @brief Class specifying whether to close convex hull
@@ -36,450 +107,6612 @@ enum class ConvexHullReturnType
     ENCLOSED
 };
 
-/// @brief Point type used in calculation of 2D Convex Hull
-template <typename T> struct Point
+/// @brief Class specifying which extreme-point polygon is used to discard interior points before hull construction
+enum class ConvexHullFilter
 {
-    static_assert(std::is_integral<T>::value || std::is_floating_point<T>::value,
-                  "Point can only be templated with integer or floating-point types");
+    NONE,
+    QUADRILATERAL,
+    OCTAGON
+};
 
-    T x, y;
+/// @brief Class that stores stages of the hull pipeline timed by ConvexHullStats
+enum class ConvexHullStage
+{
+    SELECTION,    // Sampling the input to select algorithm and filter for ConvexHullAlgorithm::AUTO
+    FILTER,       // Discarding interior points and gathering survivors
+    SORT,         // Ordering points for the scan
+    SCAN,         // Building hull chains from ordered points, or wrapping around them in Jarvis March
+    PARTITION,    // Partitioning points around hull edges in Quickhull, or into strips of the approximate hull
+    MERGE,        // Wrapping around subset hulls in Chan's algorithm, or merging chunk hulls or precomputed hulls
+    BACK_MAPPING, // Mapping hull indices of filter survivors back to input indices
+    FINALIZE      // Applying orientation and return type
+};
 
-    constexpr Point(T x, T y) : x(x), y(y)
-    {
-    }
+/// @brief Wall time per stage and work counters of the last construction that used a workspace referring to these
+/// stats, where counters include work of worker threads. Filled only if CONVEX_HULL_ENABLE_STATS is defined.
+struct ConvexHullStats
+{
+    static constexpr int number_of_stages = static_cast<int>(ConvexHullStage::FINALIZE) + 1;
 
-    bool operator<(const Point &other) const noexcept
+    ConvexHullAlgorithm algorithm = ConvexHullAlgorithm::GRAHAM_SCAN; // Algorithm that constructed the hull
+    double stage_seconds[number_of_stages] = {};                      // Wall time of each stage on calling thread
+    double total_seconds = 0;                                         // Wall time of the whole construction
+    long long number_of_points = 0;                                   // Number of input points
+    long long number_of_filtered_points = 0;   // Points discarded by the interior point filter
+    long long number_of_orientation_tests = 0; // Scalar orientation tests and cross product comparisons
+    long long number_of_hull_pops = 0;         // Vertices popped from hull chains by the scans
+    long long number_of_allocations = 0;       // Workspace and output buffers that had to grow
+    long long hull_size = 0;                   // Number of returned hull indices
+
+    double getSeconds(ConvexHullStage stage) const noexcept
     {
-        if constexpr (std::is_integral<T>::value)
-        {
-            return (y < other.y) || ((y == other.y) && (x < other.x));
-        }
-        else
-        {
-            return (y < other.y) || (std::fabs(y - other.y) < std::numeric_limits<T>::epsilon() && (x < other.x));
-        }
+        return stage_seconds[static_cast<int>(stage)];
     }
 
-    bool operator==(const Point &other) const noexcept
+    /// @brief Adds counters of stats collected on a worker thread
+    void addCounters(const ConvexHullStats &other) noexcept
     {
-        if constexpr (std::is_integral<T>::value)
-        {
-            return (x == other.x) && (y == other.y);
-        }
-        else
-        {
-            return (std::fabs(x - other.x) < std::numeric_limits<T>::epsilon()) &&
-                   (std::fabs(y - other.y) < std::numeric_limits<T>::epsilon());
-        }
+        number_of_filtered_points += other.number_of_filtered_points;
+        number_of_orientation_tests += other.number_of_orientation_tests;
+        number_of_hull_pops += other.number_of_hull_pops;
     }
 };
 
-/// @brief Function to return the cross product of two vectors (p1, p2) and (p1, p3)
-template <typename T> inline T crossProduct(const Point<T> &p1, const Point<T> &p2, const Point<T> &p3) noexcept
+#if CONVEX_HULL_STATS
+/// @brief Stats collection state of the calling thread
+struct ConvexHullStatsState
 {
-    const auto x1 = p2.x - p1.x;
-    const auto y1 = p2.y - p1.y;
-    const auto x2 = p3.x - p1.x;
-    const auto y2 = p3.y - p1.y;
-    return x1 * y2 - x2 * y1;
-}
+    ConvexHullStats *stats = nullptr;                  // Stats of the construction running on this thread
+    int stage = -1;                                    // Stage being timed, -1 before the first one
+    int suspended = 0;                                 // Nonzero while stage changes are ignored
+    std::chrono::steady_clock::time_point stage_start; // Start of the stage being timed
+};
 
-/// @brief Helper function to compute the square of the Euclidean distance between two points
-template <typename T> inline T squaredDistance(const Point<T> &p1, const Point<T> &p2) noexcept
+inline ConvexHullStatsState &getConvexHullStatsState() noexcept
 {
-    const auto dx = p2.x - p1.x;
-    const auto dy = p2.y - p1.y;
-    return dx * dx + dy * dy;
+    static thread_local ConvexHullStatsState state;
+    return state;
 }
 
-/// @brief Comparator function to sort points by polar angle with respect to the reference point
-template <typename T>
-inline bool comparePolarAngle(const Point<T> &ref, const Point<T> &p1, const Point<T> &p2) noexcept
+/// @brief Ends the stage being timed on the calling thread and starts the given one
+inline void beginConvexHullStage(ConvexHullStage stage) noexcept
 {
-    const auto cross_product = crossProduct(ref, p1, p2);
-    if (cross_product == 0)
+    auto &state = getConvexHullStatsState();
+    if (state.stats == nullptr || state.suspended > 0)
     {
-        return squaredDistance(ref, p1) < squaredDistance(ref, p2);
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (state.stage >= 0)
+    {
+        state.stats->stage_seconds[state.stage] += std::chrono::duration<double>(now - state.stage_start).count();
     }
-    return (cross_product > 0);
+    state.stage = static_cast<int>(stage);
+    state.stage_start = now;
 }
 
-/// @brief Function to check if three points form a clockwise or counterclockwise order
-template <typename T>
-inline Orientation getOrientation(const Point<T> &p1, const Point<T> &p2, const Point<T> &p3) noexcept
+inline void addConvexHullCount(long long ConvexHullStats::*counter, long long count) noexcept
 {
-    const auto cross_product = crossProduct(p1, p2, p3);
+    if (auto *stats = getConvexHullStatsState().stats)
+    {
+        stats->*counter += count;
+    }
+}
 
-    if (cross_product > 0)
+/// @brief Counts work done by other threads on behalf of the calling thread, in separate stats per worker that are
+/// added to the stats of the calling thread on destruction, once the workers have been joined. The stage of the
+/// calling thread stays in effect meanwhile.
+class ConvexHullWorkerStats
+{
+  public:
+    explicit ConvexHullWorkerStats(int number_of_workers)
+        : stats_(getConvexHullStatsState().stats),
+          worker_stats_(stats_ != nullptr ? static_cast<std::size_t>(number_of_workers) : 0)
     {
-        return Orientation::COUNTERCLOCKWISE;
+        ++getConvexHullStatsState().suspended;
     }
-    else if (cross_product < 0)
+
+    ~ConvexHullWorkerStats()
     {
-        return Orientation::CLOCKWISE;
+        --getConvexHullStatsState().suspended;
+        for (const auto &worker_stats : worker_stats_)
+        {
+            stats_->addCounters(worker_stats);
+        }
     }
-    else
+
+    ConvexHullWorkerStats(const ConvexHullWorkerStats &) = delete;
+    ConvexHullWorkerStats &operator=(const ConvexHullWorkerStats &) = delete;
+
+    /// @brief Runs task on the calling thread as worker worker_no
+    template <typename Task> void run(int worker_no, Task &&task)
     {
-        return Orientation::COLLINEAR;
+        auto &state = getConvexHullStatsState();
+        const auto previous_state = state;
+        state = ConvexHullStatsState();
+        state.stats = (stats_ != nullptr) ? &worker_stats_[worker_no] : nullptr;
+        state.suspended = 1;
+        task();
+        state = previous_state;
     }
-}
 
-/// @brief Return convex hull indices calculated using Graham-Andrew algorithm
-template <typename T>
-std::vector<int> constructGrahamScanConvexHull(const std::vector<Point<T>> &points, Orientation orientation,
-                                               ConvexHullReturnType return_type)
+  private:
+    ConvexHullStats *stats_;
+    std::vector<ConvexHullStats> worker_stats_;
+};
+#else
+class ConvexHullWorkerStats
 {
-    int n = static_cast<int>(points.size());
-    if (n < 3)
+  public:
+    explicit ConvexHullWorkerStats(int) noexcept
     {
-        // Convex Hull is not possible for less than 3 points
-        return {};
     }
 
-    // Find point with the lowest y-coordinate (and lowest x coordinate if there is a tie)
-    int min_index = 0;
-    for (int i = 1; i < n; ++i)
+    template <typename Task> void run(int, Task &&task)
     {
-        if (points[i] < points[min_index])
-        {
-            min_index = i;
-        }
+        task();
     }
+};
+#endif
 
-    // Swap the first point and the point with the lowest y-coordinate
-    std::vector<Point<T>> sorted_points = points;
-    std::swap(sorted_points[0], sorted_points[min_index]);
+/// @brief Point type used in calculation of 2D Convex Hull
+template <typename T> struct Point
+{
+    static_assert(std::is_integral<T>::value || std::is_floating_point<T>::value,
+                  "Point can only be templated with integer or floating-point types");
 
-    // Sort the remaining points based on their polar angle with respect to the reference point
-    const Point<T> &ref_point = sorted_points[0];
-    std::sort(
-        sorted_points.begin() + 1, sorted_points.end(),
-        [&](const Point<T> &p1, const Point<T> &p2) noexcept -> bool { return comparePolarAngle(ref_point, p1, p2); });
+    T x, y;
 
-    // Initialize the convex hull with the first three sorted points
-    std::vector<int> hull_indices = {0, 1, 2};
-    int hull_size = 3;
+    constexpr Point() : x(), y()
+    {
+    }
 
-    // Process remaining points
-    for (int i = 3; i < n; ++i)
+    constexpr Point(T x, T y) : x(x), y(y)
     {
-        // Remove the last point from the hull while it makes a clockwise turn with the next point
-        while (hull_size >= 2 &&
-               getOrientation(sorted_points[hull_indices[hull_size - 2]], sorted_points[hull_indices[hull_size - 1]],
-                              sorted_points[i]) != Orientation::COUNTERCLOCKWISE)
-        {
-            hull_indices.pop_back();
-            --hull_size;
-        }
+    }
 
-        // Add the next point index to the hull
-        hull_indices.push_back(i);
-        ++hull_size;
+    constexpr bool operator<(const Point &other) const noexcept
+    {
+        return (y < other.y) || ((y == other.y) && (x < other.x));
+    }
+
+    constexpr bool operator==(const Point &other) const noexcept
+    {
+        return (x == other.x) && (y == other.y);
     }
+};
+
+/// @brief Structure-of-arrays point container, storing x and y coordinates in separate contiguous arrays
+template <typename T> struct PointArray
+{
+    static_assert(std::is_integral<T>::value || std::is_floating_point<T>::value,
+                  "PointArray can only be templated with integer or floating-point types");
+
+    std::vector<T> x, y;
 
-    // Convert the indices of the sorted_points vector back to the original points vector
-    std::vector<int> original_indices(hull_size);
-    for (int i = 0; i < hull_size; ++i)
+    PointArray() = default;
+
+    explicit PointArray(const std::vector<Point<T>> &points)
     {
-        const auto hull_index = hull_indices[i];
-        for (int j = 0; j < n; ++j)
+        reserve(points.size());
+        for (const auto &point : points)
         {
-            if (sorted_points[hull_index] == points[j])
-            {
-                original_indices[i] = j;
-                break;
-            }
+            push_back(point);
         }
     }
 
-    // Check orientation, and reverse order if orientation set to CLOCKWISE
-    if (orientation == Orientation::CLOCKWISE)
+    std::size_t size() const noexcept
     {
-        std::reverse(original_indices.begin(), original_indices.end());
+        return x.size();
     }
 
-    // Check if hull should be enclosed
-    if (return_type == ConvexHullReturnType::ENCLOSED)
+    void reserve(std::size_t capacity)
     {
-        original_indices.reserve(original_indices.size() + 1);
-        original_indices.push_back(original_indices[0]);
+        x.reserve(capacity);
+        y.reserve(capacity);
     }
 
-    return original_indices;
-}
+    void push_back(const Point<T> &point)
+    {
+        x.push_back(point.x);
+        y.push_back(point.y);
+    }
 
-/// @brief Andrew's Monotone Chain convex hull algorithm
-template <typename T>
-std::vector<int> constructAndrewMonotoneChainConvexHull(const std::vector<Point<T>> &points, Orientation orientation,
-                                                        ConvexHullReturnType return_type)
-{
-    int n = static_cast<int>(points.size());
-    if (n < 3)
+    Point<T> operator[](std::size_t index) const noexcept
     {
-        // Convex Hull is not possible for less than 3 points
-        return {};
+        return Point<T>(x[index], y[index]);
     }
+};
 
-    // Preallocate indices and sort points
-    std::vector<int> hull_indices(2 * n);
-    std::vector<Point<T>> sorted_points = points;
-    std::sort(sorted_points.begin(), sorted_points.end());
+#if defined(__SIZEOF_INT128__)
+/// @brief 128-bit integer of GCC and Clang, declared through __extension__ so that -Wpedantic accepts it
+__extension__ typedef __int128 int128_t;
+#endif
 
-    // Compute lower hull
-    int k = 0;
-    for (int i = 0; i < n; ++i)
+/// @brief Non-owning view of points whose x and y coordinates are read from strided memory, where consecutive points
+/// are stride bytes apart, such as interleaved point clouds, matrices or memory-mapped files. Hulls are computed over
+/// the memory in place, which must outlive the view.
+template <typename T> struct PointView
+{
+    static_assert(std::is_integral<T>::value || std::is_floating_point<T>::value,
+                  "PointView can only be templated with integer or floating-point types");
+
+    const T *x = nullptr;
+    const T *y = nullptr;
+    std::size_t count = 0;
+    std::ptrdiff_t stride = sizeof(T);
+
+    PointView() = default;
+
+    PointView(const T *x, const T *y, std::size_t count, std::ptrdiff_t stride) noexcept
+        : x(x), y(y), count(count), stride(stride)
     {
-        while (k >= 2 && getOrientation(sorted_points[hull_indices[k - 2]], sorted_points[hull_indices[k - 1]],
-                                        sorted_points[i]) != Orientation::COUNTERCLOCKWISE)
-        {
-            --k;
-        }
-        hull_indices[k++] = i;
     }
 
-    // Compute upper hull
-    for (int i = n - 2, t = k + 1; i >= 0; --i)
+    explicit PointView(const std::vector<Point<T>> &points) noexcept
+        : PointView(points.empty() ? nullptr : &points[0].x, points.empty() ? nullptr : &points[0].y, points.size(),
+                    sizeof(Point<T>))
     {
-        while (k >= t && getOrientation(sorted_points[hull_indices[k - 2]], sorted_points[hull_indices[k - 1]],
-                                        sorted_points[i]) != Orientation::COUNTERCLOCKWISE)
-        {
-            --k;
-        }
-        hull_indices[k++] = i;
     }
 
-    // Resize convex hull to contain only required points
-    hull_indices.resize(k - 1);
+    explicit PointView(const PointArray<T> &points) noexcept
+        : PointView(points.x.data(), points.y.data(), points.size(), sizeof(T))
+    {
+    }
 
-    // Convert the indices of the sorted_points vector back to the original points vector
-    for (int i = 0; i < k - 1; ++i)
+    std::size_t size() const noexcept
     {
-        const auto hull_index = hull_indices[i];
-        for (int j = 0; j < n; ++j)
-        {
-            if (sorted_points[hull_index] == points[j])
-            {
-                hull_indices[i] = j;
-                break;
-            }
-        }
+        return count;
     }
 
-    // Check orientation, and reverse order if orientation set to CLOCKWISE
-    if (orientation == Orientation::CLOCKWISE)
+    Point<T> operator[](std::size_t index) const noexcept
     {
-        std::reverse(hull_indices.begin(), hull_indices.end());
+        const auto offset = static_cast<std::ptrdiff_t>(index) * stride;
+        return Point<T>(*reinterpret_cast<const T *>(reinterpret_cast<const char *>(x) + offset),
+                        *reinterpret_cast<const T *>(reinterpret_cast<const char *>(y) + offset));
     }
+};
 
-    // Check if hull should be enclosed
-    if (return_type == ConvexHullReturnType::ENCLOSED)
+/// @brief Coordinate accessors of external point types, which by default read public x and y members. Specialize for
+/// types that expose their coordinates differently.
+template <typename P> struct PointTraits
+{
+    using value_type = std::decay_t<decltype(std::declval<const P &>().x)>;
+
+    static value_type getX(const P &point) noexcept
     {
-        hull_indices.reserve(hull_indices.size() + 1);
-        hull_indices.push_back(hull_indices[0]);
+        return point.x;
     }
 
-    return hull_indices;
-}
+    static value_type getY(const P &point) noexcept
+    {
+        return point.y;
+    }
+};
 
-/// @brief Construct Convex Hull using Jarvis March algorithm
-template <typename T>
-std::vector<int> constructJarvisMarchConvexHull(const std::vector<Point<T>> &points, Orientation orientation,
-                                                ConvexHullReturnType return_type)
+/// @brief Non-owning view of a contiguous array of external point type P, read through PointTraits<P>
+template <typename P> struct PointSpan
 {
-    int n = static_cast<int>(points.size());
-    if (n < 3)
+    using T = typename PointTraits<P>::value_type;
+
+    const P *data = nullptr;
+    std::size_t count = 0;
+
+    PointSpan() = default;
+
+    PointSpan(const P *data, std::size_t count) noexcept : data(data), count(count)
     {
-        // Convex Hull is not possible for less than 3 points
-        return {};
     }
 
-    // Find the leftmost point (with the lowest x-coordinate)
-    int leftmost = 0;
-    for (int i = 1; i < n; ++i)
+    explicit PointSpan(const std::vector<P> &points) noexcept : data(points.data()), count(points.size())
     {
-        if (points[i].x < points[leftmost].x)
-        {
-            leftmost = i;
-        }
     }
 
-    // Start from leftmost point, keep moving counterclockwise
-    // until reaching the start point again.
-    std::vector<int> hull_indices;
-    int p = leftmost;
-    int q;
+    std::size_t size() const noexcept
+    {
+        return count;
+    }
 
-    do
+    Point<T> operator[](std::size_t index) const noexcept
     {
-        // Add current point to result
-        hull_indices.push_back(p);
+        return Point<T>(PointTraits<P>::getX(data[index]), PointTraits<P>::getY(data[index]));
+    }
+};
 
-        // Initialize q as the next point in the list
-        q = (p + 1) % n;
+/// @brief Coordinate type of a point container, which is any type providing size() and operator[] returning a point
+/// with x and y members, such as std::vector<Point<T>>, PointArray<T>, PointView<T> or PointSpan<P>
+template <typename Points> using PointCoordinate = std::decay_t<decltype(std::declval<const Points &>()[0].x)>;
 
-        // Iterate over all points to find the point with the smallest polar angle
-        // with respect to the current point (p)
-        for (int i = 0; i < n; ++i)
-        {
-            // If i is more counterclockwise than current q, then update q
-            if (getOrientation(points[p], points[i], points[q]) == Orientation::COUNTERCLOCKWISE)
-            {
-                q = i;
-            }
-        }
+/// @brief Point type used in calculation of 3D Convex Hull
+template <typename T> struct Point3
+{
+    static_assert(std::is_integral<T>::value || std::is_floating_point<T>::value,
+                  "Point3 can only be templated with integer or floating-point types");
 
-        // Set p to be q for the next iteration
-        p = q;
+    T x, y, z;
 
-    } while (p != leftmost); // Continue until we reach the starting point again
+    constexpr Point3(T x, T y, T z) : x(x), y(y), z(z)
+    {
+    }
 
-    // Check orientation, and reverse order if orientation set to CLOCKWISE
-    if (orientation == Orientation::CLOCKWISE)
+    bool operator<(const Point3 &other) const noexcept
     {
-        std::reverse(hull_indices.begin(), hull_indices.end());
+        return (z < other.z) || ((z == other.z) && ((y < other.y) || ((y == other.y) && (x < other.x))));
     }
 
-    // Check if hull should be enclosed
-    if (return_type == ConvexHullReturnType::ENCLOSED)
+    bool operator==(const Point3 &other) const noexcept
     {
-        hull_indices.reserve(hull_indices.size() + 1);
-        hull_indices.push_back(hull_indices[0]);
+        return (x == other.x) && (y == other.y) && (z == other.z);
     }
+};
 
-    return hull_indices;
-}
+/// @brief Trait selecting the type in which coordinate differences and their products are accumulated. Integer
+/// coordinates are widened (up to 16 bits to int64_t, 32 and 64 bits to int128_t), so that cross products and squared
+/// distances are exact for every 32-bit coordinate and for 64-bit coordinates with magnitude below 2^62. Without
+/// int128_t, 32-bit coordinates are accumulated in int64_t and must have magnitude below 2^30, and 64-bit coordinates
+/// are not supported. Floating-point types are used as is.
+template <typename T, bool = std::is_integral<T>::value> struct AccumulatorTraits
+{
+    using type = T;
+};
 
-/// @brief Partitions vector into approximately n equal pieces
-template <typename T>
-std::pair<std::vector<std::vector<T>>, std::vector<std::vector<int>>> partitionVector(const std::vector<T> &vec,
-                                                                                      int number_of_subsets)
+template <typename T> struct AccumulatorTraits<T, true>
 {
-    int size = vec.size();
-    int subset_size = size / number_of_subsets;
-    int remainder = size % number_of_subsets;
+#if defined(__SIZEOF_INT128__)
+    using type = typename std::conditional<(sizeof(T) <= 2), std::int64_t, int128_t>::type;
+#else
+    using type = std::int64_t;
+#endif
+};
 
-    std::vector<std::vector<T>> subsets(number_of_subsets);
-    std::vector<std::vector<int>> subset_indices(number_of_subsets);
-    int current = 0;
-    for (int i = 0; i < number_of_subsets; ++i)
-    {
-        int current_subset_size = subset_size + (i < remainder ? 1 : 0);
+template <typename T> using Accumulator = typename AccumulatorTraits<T>::type;
 
-        subsets[i].reserve(current_subset_size);
-        subset_indices[i].reserve(current_subset_size);
+/// @brief Type of coordinate differences. Differences of integers of up to 32 bits fit int64_t, and are widened to the
+/// accumulator only to be multiplied, which compiles to single widening multiplications.
+template <typename T>
+using Difference =
+    typename std::conditional<std::is_integral<T>::value && sizeof(T) <= 4, std::int64_t, Accumulator<T>>::type;
 
-        for (int j = 0; j < current_subset_size; ++j)
+/// @brief Returns true if an integer coordinate has magnitude below 2^((bits of the accumulator - 4) / 2), so that the
+/// cross products and squared distances of differences of such coordinates are exact. Floating-point coordinates are
+/// always accepted.
+template <typename T> constexpr bool isExactCoordinate(T value) noexcept
+{
+    if constexpr (std::is_integral<T>::value)
+    {
+        constexpr int bits = (8 * static_cast<int>(sizeof(Accumulator<T>)) - 4) / 2;
+        if constexpr (bits < std::numeric_limits<T>::digits)
         {
-            subsets[i].push_back(vec[current]);
-            subset_indices[i].push_back(current);
-            ++current;
+            constexpr T limit = T(1) << bits;
+            if constexpr (std::is_signed<T>::value)
+            {
+                return -limit < value && value < limit;
+            }
+            else
+            {
+                return value < limit;
+            }
         }
     }
-
-    return std::make_pair(subsets, subset_indices);
+    return true;
 }
 
-/// @brief Construct Convex Hull using Chan's algorithm, based on Andrew's Monotone Chain and Jarvis March
-template <typename T>
-std::vector<int> constructChanConvexHull(const std::vector<Point<T>> &points, Orientation orientation,
-                                         ConvexHullReturnType return_type)
+/// @brief Returns true if every coordinate of the points is accepted by isExactCoordinate, which debug builds assert
+/// on entry to constructConvexHull
+template <typename Points> bool hasExactCoordinates(const Points &points) noexcept
 {
-    int n = static_cast<int>(points.size());
-    if (n < 3)
+    for (std::size_t i = 0; i < points.size(); ++i)
     {
-        // Convex Hull is not possible for less than 3 points
-        return {};
+        if (!isExactCoordinate(points[i].x) || !isExactCoordinate(points[i].y))
+        {
+            return false;
+        }
     }
+    return true;
+}
 
-    // Find the number of subsets to split the points into
-    const int number_of_subsets = static_cast<int>(std::ceil(std::sqrt(n)));
-    const int number_of_points_within_subset = n / number_of_subsets;
-
-    // Divide points into number_of_subsets subsets each containing number_of_points_within_subset points
-    const auto [subsets, subset_indices] = partitionVector(points, number_of_subsets);
+/// @brief Floating-point type of lengths and areas derived from coordinates, double for integer coordinates
+template <typename T> using Real = typename std::conditional<std::is_floating_point<T>::value, T, double>::type;
 
-    // Compute convex hull using Graham's scan for each subset
-    std::vector<std::vector<int>> convex_hulls_indices(subsets.size());
-    for (int subset_no = 0; subset_no < subsets.size(); ++subset_no)
-    {
-        // Construct convex hull for current subset
-        convex_hulls_indices[subset_no] =
-            constructAndrewMonotoneChainConvexHull(subsets[subset_no], orientation, ConvexHullReturnType::OPEN);
-    }
+/// @brief Function to return the cross product of two vectors (p1, p2) and (p1, p3)
+template <typename T>
+constexpr Accumulator<T> crossProduct(const Point<T> &p1, const Point<T> &p2, const Point<T> &p3) noexcept
+{
+    using A = Accumulator<T>;
+    using D = Difference<T>;
+    const auto x1 = D(p2.x) - D(p1.x);
+    const auto y1 = D(p2.y) - D(p1.y);
+    const auto x2 = D(p3.x) - D(p1.x);
+    const auto y2 = D(p3.y) - D(p1.y);
+    return A(x1) * A(y2) - A(x2) * A(y1);
+}
 
-    // Merge convex hull points
-    std::vector<Point<T>> merged_points;
-    merged_points.reserve(convex_hulls_indices.size() * number_of_points_within_subset);
+/// @brief Helper function to compute the square of the Euclidean distance between two points
+template <typename T> inline Accumulator<T> squaredDistance(const Point<T> &p1, const Point<T> &p2) noexcept
+{
+    using A = Accumulator<T>;
+    using D = Difference<T>;
+    const auto dx = D(p2.x) - D(p1.x);
+    const auto dy = D(p2.y) - D(p1.y);
+    return A(dx) * A(dx) + A(dy) * A(dy);
+}
 
-    std::vector<int> merged_indices;
-    merged_indices.reserve(convex_hulls_indices.size() * number_of_points_within_subset);
+/// @brief Relative error bound of the floating-point cross product, following Shewchuk's orient2d filter
+template <typename T> constexpr T getCrossProductErrorBound() noexcept
+{
+    constexpr T epsilon = std::numeric_limits<T>::epsilon() / 2;
+    return (3 + 16 * epsilon) * epsilon;
+}
 
-    for (int subset_no = 0; subset_no < subsets.size(); ++subset_no)
+/// @brief Adds b to the nonoverlapping expansion of the given size without rounding error, following Shewchuk's
+/// Grow-Expansion, and returns the new size
+template <typename T> constexpr int growExpansion(T *expansion, int size, T b) noexcept
+{
+    for (int i = 0; i < size; ++i)
     {
-        const auto &indices = convex_hulls_indices[subset_no];
-        const auto &original_indices = subset_indices[subset_no];
-        for (const auto idx : indices)
-        {
-            const auto original_index = original_indices[idx];
-            merged_points.push_back(points[original_index]);
-            merged_indices.push_back(original_index);
-        }
+        // Two-Sum error-free transformation, b + expansion[i] = sum + error
+        const T sum = b + expansion[i];
+        const T e_virtual = sum - b;
+        const T b_virtual = sum - e_virtual;
+        expansion[i] = (b - b_virtual) + (expansion[i] - e_virtual);
+        b = sum;
     }
+    expansion[size] = b;
+    return size + 1;
+}
 
-    // Merge convex hulls using Jarvis March and obtain the indices of the points in the hull
-    std::vector<int> hull_indices =
-        constructJarvisMarchConvexHull(merged_points, orientation, ConvexHullReturnType::OPEN);
-
-    // Convert the indices of the merged_points vector back to the original points vector
-    std::vector<int> original_indices(hull_indices.size());
-    for (int i = 0; i < hull_indices.size(); ++i)
+/// @brief Returns |value|, computed without std::fabs during constant evaluation
+template <typename T> constexpr T getAbsoluteValue(T value) noexcept
+{
+    if (CONVEX_HULL_IS_CONSTANT_EVALUATED())
     {
-        original_indices[i] = merged_indices[hull_indices[i]];
+        return (value < 0) ? -value : value;
     }
+    return std::fabs(value);
+}
 
-    // Check if hull should be enclosed
-    if (return_type == ConvexHullReturnType::ENCLOSED)
+/// @brief Returns the rounding error of product = a * b, so that a * b = product + error exactly. Constant evaluation
+/// splits the factors following Dekker instead of calling std::fma.
+template <typename T> constexpr T getProductError(T a, T b, T product) noexcept
+{
+    if (CONVEX_HULL_IS_CONSTANT_EVALUATED())
     {
-        original_indices.reserve(original_indices.size() + 1);
-        original_indices.push_back(original_indices[0]);
+        // Split each factor into halves of at most half the significand bits, whose products are exact
+        constexpr T splitter = static_cast<T>(std::uint64_t(1) << ((std::numeric_limits<T>::digits + 1) / 2)) + 1;
+        const T a_big = splitter * a - a;
+        const T a_high = splitter * a - a_big;
+        const T a_low = a - a_high;
+        const T b_big = splitter * b - b;
+        const T b_high = splitter * b - b_big;
+        const T b_low = b - b_high;
+        return ((a_high * b_high - product) + a_high * b_low + a_low * b_high) + a_low * b_low;
     }
-
-    return original_indices;
+    return std::fma(a, b, -product);
 }
 
-/// @brief Main method that calls relevant functions based on provided inputs
-template <typename T>
-std::vector<int> constructConvexHull(const std::vector<Point<T>> &points,
-                                     ConvexHullAlgorithm algorithm = ConvexHullAlgorithm::GRAHAM_SCAN,
-                                     Orientation orientation = Orientation::COUNTERCLOCKWISE,
-                                     ConvexHullReturnType return_type = ConvexHullReturnType::OPEN)
+/// @brief Returns sign of the exact sum of products a[i] * b[i], accumulated into a nonoverlapping expansion
+template <typename T, int N> constexpr int getExactSumOfProductsSign(const T (&a)[N], const T (&b)[N]) noexcept
 {
-    if (orientation == Orientation::COLLINEAR)
+    T expansion[2 * N]{};
+    int size = 0;
+    for (int i = 0; i < N; ++i)
     {
-        std::cerr << "Orientation::COLLINEAR only supported internally. Returning empty hull." << std::endl;
-        return {};
+        // Two-Product error-free transformation, a[i] * b[i] = product + error
+        const T product = a[i] * b[i];
+        size = growExpansion(expansion, size, getProductError(a[i], b[i], product));
+        size = growExpansion(expansion, size, product);
     }
 
-    switch (algorithm)
+    // Components grow in magnitude, so the largest nonzero one determines the sign of the sum
+    for (int i = size - 1; i >= 0; --i)
     {
-    case ConvexHullAlgorithm::GRAHAM_SCAN: {
-        return constructGrahamScanConvexHull(points, orientation, return_type);
-    }
-    case ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN: {
-        return constructAndrewMonotoneChainConvexHull(points, orientation, return_type);
-    }
-    case ConvexHullAlgorithm::JARVIS_MARCH: {
-        return constructJarvisMarchConvexHull(points, orientation, return_type);
+        if (expansion[i] != 0)
+        {
+            return (expansion[i] > 0) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+/// @brief Returns exact sign of (a[0] - b[0]) * (a[1] - b[1]) - (a[2] - b[2]) * (a[3] - b[3])
+template <typename T> constexpr int getExactDeterminantSign(const T (&a)[4], const T (&b)[4]) noexcept
+{
+    // Differences are usually exact, in which case rounding of their products is monotonic and the product errors
+    // decide ties
+    T d[4]{};
+    bool is_exact = true;
+    for (int i = 0; i < 4; ++i)
+    {
+        // Two-Diff error-free transformation, a[i] - b[i] = d[i] + tail
+        d[i] = a[i] - b[i];
+        const T b_virtual = a[i] - d[i];
+        const T a_virtual = d[i] + b_virtual;
+        is_exact &= ((a[i] - a_virtual) + (b_virtual - b[i]) == 0);
+    }
+    if (is_exact)
+    {
+        const T left = d[0] * d[1];
+        const T right = d[2] * d[3];
+        if (left != right)
+        {
+            return (left > right) ? 1 : -1;
+        }
+        const T left_error = getProductError(d[0], d[1], left);
+        const T right_error = getProductError(d[2], d[3], right);
+        return (left_error > right_error) - (left_error < right_error);
+    }
+
+    // Otherwise expand the determinant into products of the inputs
+    const T factors_a[8] = {a[0], -a[0], -b[0], b[0], -a[2], a[2], b[2], -b[2]};
+    const T factors_b[8] = {a[1], b[1], a[1], b[1], a[3], b[3], a[3], b[3]};
+    return getExactSumOfProductsSign(factors_a, factors_b);
+}
+
+/// @brief Returns sign of (a[0] - b[0]) * (a[1] - b[1]) - (a[2] - b[2]) * (a[3] - b[3]). Floating-point inputs are
+/// evaluated adaptively: the rounded result is used when it exceeds its error bound, and the sign is computed exactly
+/// otherwise.
+template <typename T> constexpr int getAdaptiveDeterminantSign(const T (&a)[4], const T (&b)[4]) noexcept
+{
+    const T left = (a[0] - b[0]) * (a[1] - b[1]);
+    const T right = (a[2] - b[2]) * (a[3] - b[3]);
+    const T determinant = left - right;
+    if constexpr (std::is_floating_point<T>::value && CONVEX_HULL_ROBUST_PREDICATES)
+    {
+        const T error_bound = getCrossProductErrorBound<T>() * (getAbsoluteValue(left) + getAbsoluteValue(right));
+        if (getAbsoluteValue(determinant) < error_bound)
+        {
+            return getExactDeterminantSign(a, b);
+        }
+    }
+    return (determinant > 0) - (determinant < 0);
+}
+
+/// @brief Returns sign of the cross product of vectors (p1, p2) and (p1, p3) like getOrientationSign, without
+/// counting the test in the stats, so that it can be evaluated at compile time
+template <typename T>
+constexpr int getUncountedOrientationSign(const Point<T> &p1, const Point<T> &p2, const Point<T> &p3) noexcept
+{
+    if constexpr (std::is_floating_point<T>::value && CONVEX_HULL_ROBUST_PREDICATES)
+    {
+        return getAdaptiveDeterminantSign<T>({p2.x, p3.y, p2.y, p3.x}, {p1.x, p1.y, p1.y, p1.x});
+    }
+    else
+    {
+        const auto cross_product = crossProduct(p1, p2, p3);
+        return (cross_product > 0) - (cross_product < 0);
+    }
+}
+
+/// @brief Returns sign of the cross product of vectors (p1, p2) and (p1, p3), which is 1 for a counterclockwise turn,
+/// -1 for a clockwise turn and 0 for collinear points, exact unless fast predicates are requested
+template <typename T>
+inline int getOrientationSign(const Point<T> &p1, const Point<T> &p2, const Point<T> &p3) noexcept
+{
+    CONVEX_HULL_COUNT(number_of_orientation_tests, 1);
+    return getUncountedOrientationSign(p1, p2, p3);
+}
+
+/// @brief Returns sign of crossProduct(p1, p2, a) - crossProduct(p1, p2, b), comparing how far a and b lie to the
+/// left of the directed line (p1, p2), exact unless fast predicates are requested
+template <typename T>
+inline int compareCrossProducts(const Point<T> &p1, const Point<T> &p2, const Point<T> &a, const Point<T> &b) noexcept
+{
+    CONVEX_HULL_COUNT(number_of_orientation_tests, 1);
+    if constexpr (std::is_floating_point<T>::value && CONVEX_HULL_ROBUST_PREDICATES)
+    {
+        // (x2 - x1) * (ya - yb) - (y2 - y1) * (xa - xb)
+        return getAdaptiveDeterminantSign<T>({p2.x, a.y, p2.y, a.x}, {p1.x, b.y, p1.y, b.x});
+    }
+    else
+    {
+        using A = Accumulator<T>;
+        using D = Difference<T>;
+        const auto difference = A(D(p2.x) - D(p1.x)) * A(D(a.y) - D(b.y)) - A(D(p2.y) - D(p1.y)) * A(D(a.x) - D(b.x));
+        return (difference > 0) - (difference < 0);
+    }
+}
+
+/// @brief Comparator function to sort points by polar angle with respect to the reference point
+template <typename T>
+inline bool comparePolarAngle(const Point<T> &ref, const Point<T> &p1, const Point<T> &p2) noexcept
+{
+    const int orientation = getOrientationSign(ref, p1, p2);
+    if (orientation == 0)
+    {
+        return squaredDistance(ref, p1) < squaredDistance(ref, p2);
+    }
+    return (orientation > 0);
+}
+
+/// @brief Relative error bound of the floating-point 3x3 determinant, following Shewchuk's orient3d filter
+template <typename T> constexpr T getOrientation3ErrorBound() noexcept
+{
+    constexpr T epsilon = std::numeric_limits<T>::epsilon() / 2;
+    return (7 + 56 * epsilon) * epsilon;
+}
+
+/// @brief Returns sign of the exact sum of triple products a[i] * b[i] * c[i], accumulated into a nonoverlapping
+/// expansion
+template <typename T, int N>
+int getExactSumOfTripleProductsSign(const T (&a)[N], const T (&b)[N], const T (&c)[N]) noexcept
+{
+    T expansion[4 * N];
+    int size = 0;
+    for (int i = 0; i < N; ++i)
+    {
+        // Two-Product of a[i] * b[i] = product + error, then of both terms with c[i]
+        const T product = a[i] * b[i];
+        const T error = std::fma(a[i], b[i], -product);
+        const T high = product * c[i];
+        const T low = error * c[i];
+        size = growExpansion(expansion, size, std::fma(error, c[i], -low));
+        size = growExpansion(expansion, size, low);
+        size = growExpansion(expansion, size, std::fma(product, c[i], -high));
+        size = growExpansion(expansion, size, high);
+    }
+
+    for (int i = size - 1; i >= 0; --i)
+    {
+        if (expansion[i] != 0)
+        {
+            return (expansion[i] > 0) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+/// @brief Returns (p2 - p1) x (p3 - p1) . (p4 - p1) rounded to the working type, which is positive when p4 lies above
+/// the plane through p1, p2 and p3, that is on the side from which they appear counterclockwise, together with the
+/// sign of the exact value. Integer coordinates are evaluated in double, which is exact below magnitude 2^53.
+template <typename T>
+int getOrientationSign(const Point3<T> &p1, const Point3<T> &p2, const Point3<T> &p3, const Point3<T> &p4,
+                       typename std::conditional<std::is_integral<T>::value, double, T>::type &volume) noexcept
+{
+    using F = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+    // Differences to p4, as in Shewchuk's orient3d, whose sign is opposite
+    const F adx = F(p1.x) - F(p4.x), ady = F(p1.y) - F(p4.y), adz = F(p1.z) - F(p4.z);
+    const F bdx = F(p2.x) - F(p4.x), bdy = F(p2.y) - F(p4.y), bdz = F(p2.z) - F(p4.z);
+    const F cdx = F(p3.x) - F(p4.x), cdy = F(p3.y) - F(p4.y), cdz = F(p3.z) - F(p4.z);
+    const F bc = bdx * cdy - cdx * bdy;
+    const F ca = cdx * ady - adx * cdy;
+    const F ab = adx * bdy - bdx * ady;
+    volume = -(adz * bc + bdz * ca + cdz * ab);
+
+    if constexpr (std::is_integral<T>::value || CONVEX_HULL_ROBUST_PREDICATES)
+    {
+        const F permanent = (std::fabs(bdx * cdy) + std::fabs(cdx * bdy)) * std::fabs(adz) +
+                            (std::fabs(cdx * ady) + std::fabs(adx * cdy)) * std::fabs(bdz) +
+                            (std::fabs(adx * bdy) + std::fabs(bdx * ady)) * std::fabs(cdz);
+        const F error_bound = getOrientation3ErrorBound<F>() * permanent;
+        if (getAbsoluteValue(volume) < error_bound)
+        {
+            // The determinant of differences equals the 4x4 determinant of homogeneous coordinates, expanded here
+            // into 24 triple products of the inputs, which are exact
+            const F x[4] = {F(p1.x), F(p2.x), F(p3.x), F(p4.x)};
+            const F y[4] = {F(p1.y), F(p2.y), F(p3.y), F(p4.y)};
+            const F z[4] = {F(p1.z), F(p2.z), F(p3.z), F(p4.z)};
+            F a[24], b[24], c[24];
+            int term = 0;
+            constexpr int minors[4][3] = {{1, 2, 3}, {0, 2, 3}, {0, 1, 3}, {0, 1, 2}};
+            for (int row = 0; row < 4; ++row)
+            {
+                // Cofactor of the column of ones, negated to follow the sign convention above
+                const F sign = (row % 2 == 0) ? F(1) : F(-1);
+                const int i = minors[row][0], j = minors[row][1], k = minors[row][2];
+                const int permutations[6][3] = {{i, j, k}, {j, k, i}, {k, i, j}, {i, k, j}, {j, i, k}, {k, j, i}};
+                for (int permutation = 0; permutation < 6; ++permutation)
+                {
+                    const auto &indices = permutations[permutation];
+                    a[term] = (permutation < 3 ? sign : -sign) * x[indices[0]];
+                    b[term] = y[indices[1]];
+                    c[term] = z[indices[2]];
+                    ++term;
+                }
+            }
+            return getExactSumOfTripleProductsSign(a, b, c);
+        }
+    }
+    return (volume > 0) - (volume < 0);
+}
+
+/// @brief Returns sign of (p2 - p1) x (p3 - p1) . (p4 - p1), which is 1 when p4 lies above the plane through p1, p2
+/// and p3, -1 below it and 0 for coplanar points, exact unless fast predicates are requested for floating-point points
+template <typename T>
+inline int getOrientationSign(const Point3<T> &p1, const Point3<T> &p2, const Point3<T> &p3,
+                              const Point3<T> &p4) noexcept
+{
+    typename std::conditional<std::is_integral<T>::value, double, T>::type volume;
+    return getOrientationSign(p1, p2, p3, p4, volume);
+}
+
+/// @brief Function to check if three points form a clockwise or counterclockwise order
+template <typename T>
+inline Orientation getOrientation(const Point<T> &p1, const Point<T> &p2, const Point<T> &p3) noexcept
+{
+    const int orientation = getOrientationSign(p1, p2, p3);
+
+    if (orientation > 0)
+    {
+        return Orientation::COUNTERCLOCKWISE;
+    }
+    else if (orientation < 0)
+    {
+        return Orientation::CLOCKWISE;
+    }
+    else
+    {
+        return Orientation::COLLINEAR;
+    }
+}
+
+/// @brief Indices of the extreme points along x, y, x + y and x - y (first occurrence on ties)
+struct ExtremePointIndices
+{
+    int min_x, max_x, min_y, max_y, min_sum, max_sum, min_diff, max_diff;
+};
+
+/// @brief Instruction set used by the batched kernels, detected once at runtime
+enum class SimdLevel
+{
+    SCALAR,
+    AVX2,
+    AVX512
+};
+
+/// @brief Returns the widest instruction set supported by both the build and the running CPU
+inline SimdLevel getSimdLevel() noexcept
+{
+#if CONVEX_HULL_X86_SIMD
+    static const SimdLevel simd_level = __builtin_cpu_supports("avx512f") ? SimdLevel::AVX512
+                                        : __builtin_cpu_supports("avx2")  ? SimdLevel::AVX2
+                                                                          : SimdLevel::SCALAR;
+    return simd_level;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+/// @brief Computes cross products of vectors (p1, p2) and (p1, (x[i], y[i])) for n points
+template <typename T>
+void computeCrossProductsScalar(const T *x, const T *y, int n, const Point<T> &p1, const Point<T> &p2,
+                                Accumulator<T> *cross_products) noexcept
+{
+    using A = Accumulator<T>;
+    using D = Difference<T>;
+    const A dx = D(p2.x) - D(p1.x);
+    const A dy = D(p2.y) - D(p1.y);
+    for (int i = 0; i < n; ++i)
+    {
+        cross_products[i] = dx * A(D(y[i]) - D(p1.y)) - A(D(x[i]) - D(p1.x)) * dy;
+    }
+}
+
+/// @brief Continues an extreme point search over points [first, n), starting from already found extremes
+template <typename T>
+void updateExtremePointsScalar(const T *x, const T *y, int first, int n, ExtremePointIndices &extremes) noexcept
+{
+    using A = Accumulator<T>;
+    const auto sum = [&](int i) noexcept { return A(x[i]) + A(y[i]); };
+    const auto difference = [&](int i) noexcept { return A(x[i]) - A(y[i]); };
+    for (int i = first; i < n; ++i)
+    {
+        extremes.min_x = (x[i] < x[extremes.min_x]) ? i : extremes.min_x;
+        extremes.max_x = (x[i] > x[extremes.max_x]) ? i : extremes.max_x;
+        extremes.min_y = (y[i] < y[extremes.min_y]) ? i : extremes.min_y;
+        extremes.max_y = (y[i] > y[extremes.max_y]) ? i : extremes.max_y;
+        extremes.min_sum = (sum(i) < sum(extremes.min_sum)) ? i : extremes.min_sum;
+        extremes.max_sum = (sum(i) > sum(extremes.max_sum)) ? i : extremes.max_sum;
+        extremes.min_diff = (difference(i) < difference(extremes.min_diff)) ? i : extremes.min_diff;
+        extremes.max_diff = (difference(i) > difference(extremes.max_diff)) ? i : extremes.max_diff;
+    }
+}
+
+/// @brief Finds extreme points along x, y, x + y and x - y for n > 0 points
+template <typename T> ExtremePointIndices findExtremePointsScalar(const T *x, const T *y, int n) noexcept
+{
+    ExtremePointIndices extremes{0, 0, 0, 0, 0, 0, 0, 0};
+    updateExtremePointsScalar(x, y, 1, n, extremes);
+    return extremes;
+}
+
+/// @brief Returns true if point i should replace the current best candidate q in the Jarvis March step from p,
+/// given squared distances from p: i lies to the right of the ray from p through q, or is collinear and farther
+template <typename T>
+inline bool isMoreClockwise(const Point<T> &p, const Point<T> &q, Accumulator<T> q_distance, const Point<T> &i,
+                            Accumulator<T> i_distance) noexcept
+{
+    const int orientation = getOrientationSign(p, q, i);
+    return orientation < 0 || (orientation == 0 && i_distance > q_distance);
+}
+
+/// @brief Finds the point that all other points lie to the left of, as seen from point p (the next counterclockwise
+/// hull vertex in Jarvis March), starting the search from candidate q. Collinear ties resolve to the farthest point,
+/// duplicates of p are skipped.
+template <typename T>
+int findMostClockwisePointScalar(const T *x, const T *y, int first, int last, int p, int q) noexcept
+{
+    const Point<T> p_point(x[p], y[p]);
+    auto q_distance = squaredDistance(p_point, Point<T>(x[q], y[q]));
+    for (int i = first; i < last; ++i)
+    {
+        const Point<T> i_point(x[i], y[i]);
+        const auto i_distance = squaredDistance(p_point, i_point);
+        if ((x[i] != x[p] || y[i] != y[p]) &&
+            isMoreClockwise(p_point, Point<T>(x[q], y[q]), q_distance, i_point, i_distance))
+        {
+            q = i;
+            q_distance = i_distance;
+        }
+    }
+    return q;
+}
+
+#if CONVEX_HULL_X86_SIMD
+/// @brief Tracks per-lane minimum and maximum of value and their indices
+CONVEX_HULL_TARGET("avx2")
+inline void updateExtremeAvx2(__m256d value, __m256d index, __m256d &min_value, __m256d &min_index,
+                              __m256d &max_value, __m256d &max_index) noexcept
+{
+    const __m256d is_less = _mm256_cmp_pd(value, min_value, _CMP_LT_OQ);
+    const __m256d is_greater = _mm256_cmp_pd(value, max_value, _CMP_GT_OQ);
+    min_value = _mm256_blendv_pd(min_value, value, is_less);
+    min_index = _mm256_blendv_pd(min_index, index, is_less);
+    max_value = _mm256_blendv_pd(max_value, value, is_greater);
+    max_index = _mm256_blendv_pd(max_index, index, is_greater);
+}
+
+/// @brief Tracks per-lane minimum and maximum of value and their indices
+CONVEX_HULL_TARGET("avx512f")
+inline void updateExtremeAvx512(__m512d value, __m512d index, __m512d &min_value, __m512d &min_index,
+                                __m512d &max_value, __m512d &max_index) noexcept
+{
+    const __mmask8 is_less = _mm512_cmp_pd_mask(value, min_value, _CMP_LT_OQ);
+    const __mmask8 is_greater = _mm512_cmp_pd_mask(value, max_value, _CMP_GT_OQ);
+    min_value = _mm512_mask_blend_pd(is_less, min_value, value);
+    min_index = _mm512_mask_blend_pd(is_less, min_index, index);
+    max_value = _mm512_mask_blend_pd(is_greater, max_value, value);
+    max_index = _mm512_mask_blend_pd(is_greater, max_index, index);
+}
+
+/// @brief Reduces per-lane extremes to a single index, preferring the lowest index on ties
+inline int reduceExtremeLanes(const double *values, const double *indices, int lanes, bool is_max) noexcept
+{
+    int best = 0;
+    for (int lane = 1; lane < lanes; ++lane)
+    {
+        const bool is_better = is_max ? (values[lane] > values[best]) : (values[lane] < values[best]);
+        if (is_better || (values[lane] == values[best] && indices[lane] < indices[best]))
+        {
+            best = lane;
+        }
+    }
+    return static_cast<int>(indices[best]);
+}
+
+CONVEX_HULL_TARGET("avx2")
+inline int reduceExtremeAvx2(__m256d value, __m256d index, bool is_max) noexcept
+{
+    alignas(32) double values[4], indices[4];
+    _mm256_store_pd(values, value);
+    _mm256_store_pd(indices, index);
+    return reduceExtremeLanes(values, indices, 4, is_max);
+}
+
+CONVEX_HULL_TARGET("avx512f")
+inline int reduceExtremeAvx512(__m512d value, __m512d index, bool is_max) noexcept
+{
+    alignas(64) double values[8], indices[8];
+    _mm512_store_pd(values, value);
+    _mm512_store_pd(indices, index);
+    return reduceExtremeLanes(values, indices, 8, is_max);
+}
+
+CONVEX_HULL_TARGET("avx2")
+inline void computeCrossProductsAvx2(const double *x, const double *y, int n, const Point<double> &p1,
+                                     const Point<double> &p2, double *cross_products) noexcept
+{
+    const __m256d p1_x = _mm256_set1_pd(p1.x);
+    const __m256d p1_y = _mm256_set1_pd(p1.y);
+    const __m256d dx = _mm256_set1_pd(p2.x - p1.x);
+    const __m256d dy = _mm256_set1_pd(p2.y - p1.y);
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d rx = _mm256_sub_pd(_mm256_loadu_pd(x + i), p1_x);
+        const __m256d ry = _mm256_sub_pd(_mm256_loadu_pd(y + i), p1_y);
+        _mm256_storeu_pd(cross_products + i, _mm256_sub_pd(_mm256_mul_pd(dx, ry), _mm256_mul_pd(rx, dy)));
+    }
+    computeCrossProductsScalar(x + i, y + i, n - i, p1, p2, cross_products + i);
+}
+
+CONVEX_HULL_TARGET("avx512f")
+inline void computeCrossProductsAvx512(const double *x, const double *y, int n, const Point<double> &p1,
+                                       const Point<double> &p2, double *cross_products) noexcept
+{
+    const __m512d p1_x = _mm512_set1_pd(p1.x);
+    const __m512d p1_y = _mm512_set1_pd(p1.y);
+    const __m512d dx = _mm512_set1_pd(p2.x - p1.x);
+    const __m512d dy = _mm512_set1_pd(p2.y - p1.y);
+
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m512d rx = _mm512_sub_pd(_mm512_loadu_pd(x + i), p1_x);
+        const __m512d ry = _mm512_sub_pd(_mm512_loadu_pd(y + i), p1_y);
+        _mm512_storeu_pd(cross_products + i, _mm512_sub_pd(_mm512_mul_pd(dx, ry), _mm512_mul_pd(rx, dy)));
+    }
+    computeCrossProductsScalar(x + i, y + i, n - i, p1, p2, cross_products + i);
+}
+
+CONVEX_HULL_TARGET("avx2")
+inline ExtremePointIndices findExtremePointsAvx2(const double *x, const double *y, int n) noexcept
+{
+    // Every lane starts from point 0, so that ties resolve to the first occurrence after reduction
+    const __m256d x0 = _mm256_set1_pd(x[0]);
+    const __m256d y0 = _mm256_set1_pd(y[0]);
+    __m256d min_x = x0, max_x = x0, min_y = y0, max_y = y0;
+    __m256d min_sum = _mm256_add_pd(x0, y0), max_sum = min_sum;
+    __m256d min_diff = _mm256_sub_pd(x0, y0), max_diff = min_diff;
+    __m256d min_x_index = _mm256_setzero_pd(), max_x_index = min_x_index, min_y_index = min_x_index,
+            max_y_index = min_x_index, min_sum_index = min_x_index, max_sum_index = min_x_index,
+            min_diff_index = min_x_index, max_diff_index = min_x_index;
+
+    __m256d index = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+    const __m256d step = _mm256_set1_pd(4.0);
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d vx = _mm256_loadu_pd(x + i);
+        const __m256d vy = _mm256_loadu_pd(y + i);
+        updateExtremeAvx2(vx, index, min_x, min_x_index, max_x, max_x_index);
+        updateExtremeAvx2(vy, index, min_y, min_y_index, max_y, max_y_index);
+        updateExtremeAvx2(_mm256_add_pd(vx, vy), index, min_sum, min_sum_index, max_sum, max_sum_index);
+        updateExtremeAvx2(_mm256_sub_pd(vx, vy), index, min_diff, min_diff_index, max_diff, max_diff_index);
+        index = _mm256_add_pd(index, step);
+    }
+
+    ExtremePointIndices extremes{reduceExtremeAvx2(min_x, min_x_index, false),
+                                 reduceExtremeAvx2(max_x, max_x_index, true),
+                                 reduceExtremeAvx2(min_y, min_y_index, false),
+                                 reduceExtremeAvx2(max_y, max_y_index, true),
+                                 reduceExtremeAvx2(min_sum, min_sum_index, false),
+                                 reduceExtremeAvx2(max_sum, max_sum_index, true),
+                                 reduceExtremeAvx2(min_diff, min_diff_index, false),
+                                 reduceExtremeAvx2(max_diff, max_diff_index, true)};
+    updateExtremePointsScalar(x, y, i, n, extremes);
+    return extremes;
+}
+
+CONVEX_HULL_TARGET("avx512f")
+inline ExtremePointIndices findExtremePointsAvx512(const double *x, const double *y, int n) noexcept
+{
+    // Every lane starts from point 0, so that ties resolve to the first occurrence after reduction
+    const __m512d x0 = _mm512_set1_pd(x[0]);
+    const __m512d y0 = _mm512_set1_pd(y[0]);
+    __m512d min_x = x0, max_x = x0, min_y = y0, max_y = y0;
+    __m512d min_sum = _mm512_add_pd(x0, y0), max_sum = min_sum;
+    __m512d min_diff = _mm512_sub_pd(x0, y0), max_diff = min_diff;
+    __m512d min_x_index = _mm512_setzero_pd(), max_x_index = min_x_index, min_y_index = min_x_index,
+            max_y_index = min_x_index, min_sum_index = min_x_index, max_sum_index = min_x_index,
+            min_diff_index = min_x_index, max_diff_index = min_x_index;
+
+    __m512d index = _mm512_set_pd(7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0);
+    const __m512d step = _mm512_set1_pd(8.0);
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m512d vx = _mm512_loadu_pd(x + i);
+        const __m512d vy = _mm512_loadu_pd(y + i);
+        updateExtremeAvx512(vx, index, min_x, min_x_index, max_x, max_x_index);
+        updateExtremeAvx512(vy, index, min_y, min_y_index, max_y, max_y_index);
+        updateExtremeAvx512(_mm512_add_pd(vx, vy), index, min_sum, min_sum_index, max_sum, max_sum_index);
+        updateExtremeAvx512(_mm512_sub_pd(vx, vy), index, min_diff, min_diff_index, max_diff, max_diff_index);
+        index = _mm512_add_pd(index, step);
+    }
+
+    ExtremePointIndices extremes{reduceExtremeAvx512(min_x, min_x_index, false),
+                                 reduceExtremeAvx512(max_x, max_x_index, true),
+                                 reduceExtremeAvx512(min_y, min_y_index, false),
+                                 reduceExtremeAvx512(max_y, max_y_index, true),
+                                 reduceExtremeAvx512(min_sum, min_sum_index, false),
+                                 reduceExtremeAvx512(max_sum, max_sum_index, true),
+                                 reduceExtremeAvx512(min_diff, min_diff_index, false),
+                                 reduceExtremeAvx512(max_diff, max_diff_index, true)};
+    updateExtremePointsScalar(x, y, i, n, extremes);
+    return extremes;
+}
+
+/// @brief Reduces per-lane Jarvis March candidates from p, preferring the lowest index among duplicates
+inline int reduceMostClockwiseLanes(const double *x, const double *y, int p, const double *q_distance,
+                                    const double *q_index, int lanes) noexcept
+{
+    const Point<double> p_point(x[p], y[p]);
+    int best = 0;
+    for (int lane = 1; lane < lanes; ++lane)
+    {
+        const int b = static_cast<int>(q_index[best]);
+        const int l = static_cast<int>(q_index[lane]);
+        const int orientation = getOrientationSign(p_point, Point<double>(x[b], y[b]), Point<double>(x[l], y[l]));
+        if (orientation < 0 ||
+            (orientation == 0 && (q_distance[lane] > q_distance[best] ||
+                                  (q_distance[lane] == q_distance[best] && q_index[lane] < q_index[best]))))
+        {
+            best = lane;
+        }
+    }
+    return static_cast<int>(q_index[best]);
+}
+
+CONVEX_HULL_TARGET("avx2")
+inline int findMostClockwisePointAvx2(const double *x, const double *y, int n, int p, int q) noexcept
+{
+    const __m256d p_x = _mm256_set1_pd(x[p]);
+    const __m256d p_y = _mm256_set1_pd(y[p]);
+    const __m256d zero = _mm256_setzero_pd();
+
+    // Every lane starts from candidate q and tracks its best candidate relative to p
+    __m256d qx = _mm256_set1_pd(x[q] - x[p]);
+    __m256d qy = _mm256_set1_pd(y[q] - y[p]);
+    __m256d q_distance = _mm256_add_pd(_mm256_mul_pd(qx, qx), _mm256_mul_pd(qy, qy));
+    __m256d q_index = _mm256_set1_pd(static_cast<double>(q));
+
+#if CONVEX_HULL_ROBUST_PREDICATES
+    // Orientations within the rounding error bound are resolved exactly by the scalar search
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+    const __m256d error_bound = _mm256_set1_pd(getCrossProductErrorBound<double>());
+    int is_uncertain = 0;
+#endif
+
+    __m256d index = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+    const __m256d step = _mm256_set1_pd(4.0);
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d ix = _mm256_sub_pd(_mm256_loadu_pd(x + i), p_x);
+        const __m256d iy = _mm256_sub_pd(_mm256_loadu_pd(y + i), p_y);
+        const __m256d i_distance = _mm256_add_pd(_mm256_mul_pd(ix, ix), _mm256_mul_pd(iy, iy));
+        const __m256d left = _mm256_mul_pd(qx, iy);
+        const __m256d right = _mm256_mul_pd(ix, qy);
+        const __m256d cross_product = _mm256_sub_pd(left, right);
+
+        const __m256d is_distinct =
+            _mm256_or_pd(_mm256_cmp_pd(ix, zero, _CMP_NEQ_UQ), _mm256_cmp_pd(iy, zero, _CMP_NEQ_UQ));
+#if CONVEX_HULL_ROBUST_PREDICATES
+        const __m256d bound = _mm256_mul_pd(
+            error_bound, _mm256_add_pd(_mm256_andnot_pd(sign_mask, left), _mm256_andnot_pd(sign_mask, right)));
+        is_uncertain |= _mm256_movemask_pd(
+            _mm256_and_pd(is_distinct, _mm256_cmp_pd(_mm256_andnot_pd(sign_mask, cross_product), bound, _CMP_LT_OQ)));
+#endif
+        const __m256d is_farther = _mm256_and_pd(_mm256_cmp_pd(cross_product, zero, _CMP_EQ_OQ),
+                                                 _mm256_cmp_pd(i_distance, q_distance, _CMP_GT_OQ));
+        const __m256d is_better =
+            _mm256_and_pd(is_distinct, _mm256_or_pd(_mm256_cmp_pd(cross_product, zero, _CMP_LT_OQ), is_farther));
+
+        qx = _mm256_blendv_pd(qx, ix, is_better);
+        qy = _mm256_blendv_pd(qy, iy, is_better);
+        q_distance = _mm256_blendv_pd(q_distance, i_distance, is_better);
+        q_index = _mm256_blendv_pd(q_index, index, is_better);
+        index = _mm256_add_pd(index, step);
+    }
+
+#if CONVEX_HULL_ROBUST_PREDICATES
+    if (is_uncertain)
+    {
+        return findMostClockwisePointScalar(x, y, q + 1, n, p, q);
+    }
+#endif
+
+    alignas(32) double lane_distance[4], lane_index[4];
+    _mm256_store_pd(lane_distance, q_distance);
+    _mm256_store_pd(lane_index, q_index);
+    q = reduceMostClockwiseLanes(x, y, p, lane_distance, lane_index, 4);
+    return findMostClockwisePointScalar(x, y, i, n, p, q);
+}
+
+CONVEX_HULL_TARGET("avx512f")
+inline int findMostClockwisePointAvx512(const double *x, const double *y, int n, int p, int q) noexcept
+{
+    const __m512d p_x = _mm512_set1_pd(x[p]);
+    const __m512d p_y = _mm512_set1_pd(y[p]);
+    const __m512d zero = _mm512_setzero_pd();
+
+    // Every lane starts from candidate q and tracks its best candidate relative to p
+    __m512d qx = _mm512_set1_pd(x[q] - x[p]);
+    __m512d qy = _mm512_set1_pd(y[q] - y[p]);
+    __m512d q_distance = _mm512_add_pd(_mm512_mul_pd(qx, qx), _mm512_mul_pd(qy, qy));
+    __m512d q_index = _mm512_set1_pd(static_cast<double>(q));
+
+#if CONVEX_HULL_ROBUST_PREDICATES
+    // Orientations within the rounding error bound are resolved exactly by the scalar search
+    const __m512d error_bound = _mm512_set1_pd(getCrossProductErrorBound<double>());
+    __mmask8 is_uncertain = 0;
+#endif
+
+    __m512d index = _mm512_set_pd(7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0);
+    const __m512d step = _mm512_set1_pd(8.0);
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m512d ix = _mm512_sub_pd(_mm512_loadu_pd(x + i), p_x);
+        const __m512d iy = _mm512_sub_pd(_mm512_loadu_pd(y + i), p_y);
+        const __m512d i_distance = _mm512_add_pd(_mm512_mul_pd(ix, ix), _mm512_mul_pd(iy, iy));
+        const __m512d left = _mm512_mul_pd(qx, iy);
+        const __m512d right = _mm512_mul_pd(ix, qy);
+        const __m512d cross_product = _mm512_sub_pd(left, right);
+
+        const __mmask8 is_distinct =
+            _mm512_cmp_pd_mask(ix, zero, _CMP_NEQ_UQ) | _mm512_cmp_pd_mask(iy, zero, _CMP_NEQ_UQ);
+#if CONVEX_HULL_ROBUST_PREDICATES
+        const __m512d bound = _mm512_mul_pd(error_bound, _mm512_add_pd(_mm512_abs_pd(left), _mm512_abs_pd(right)));
+        is_uncertain |= is_distinct & _mm512_cmp_pd_mask(_mm512_abs_pd(cross_product), bound, _CMP_LT_OQ);
+#endif
+        const __mmask8 is_farther = _mm512_cmp_pd_mask(cross_product, zero, _CMP_EQ_OQ) &
+                                    _mm512_cmp_pd_mask(i_distance, q_distance, _CMP_GT_OQ);
+        const __mmask8 is_better = is_distinct & (_mm512_cmp_pd_mask(cross_product, zero, _CMP_LT_OQ) | is_farther);
+
+        qx = _mm512_mask_blend_pd(is_better, qx, ix);
+        qy = _mm512_mask_blend_pd(is_better, qy, iy);
+        q_distance = _mm512_mask_blend_pd(is_better, q_distance, i_distance);
+        q_index = _mm512_mask_blend_pd(is_better, q_index, index);
+        index = _mm512_add_pd(index, step);
+    }
+
+#if CONVEX_HULL_ROBUST_PREDICATES
+    if (is_uncertain)
+    {
+        return findMostClockwisePointScalar(x, y, q + 1, n, p, q);
+    }
+#endif
+
+    alignas(64) double lane_distance[8], lane_index[8];
+    _mm512_store_pd(lane_distance, q_distance);
+    _mm512_store_pd(lane_index, q_index);
+    q = reduceMostClockwiseLanes(x, y, p, lane_distance, lane_index, 8);
+    return findMostClockwisePointScalar(x, y, i, n, p, q);
+}
+#endif
+
+/// @brief Batched orientation test of n points against the fixed edge (p1, p2), storing cross products of vectors
+/// (p1, p2) and (p1, (x[i], y[i])), dispatched to the widest available instruction set
+template <typename T>
+void computeCrossProducts(const T *x, const T *y, int n, const Point<T> &p1, const Point<T> &p2,
+                          Accumulator<T> *cross_products) noexcept
+{
+#if CONVEX_HULL_X86_SIMD
+    if constexpr (std::is_same<T, double>::value)
+    {
+        switch (getSimdLevel())
+        {
+        case SimdLevel::AVX512:
+            return computeCrossProductsAvx512(x, y, n, p1, p2, cross_products);
+        case SimdLevel::AVX2:
+            return computeCrossProductsAvx2(x, y, n, p1, p2, cross_products);
+        default:
+            break;
+        }
+    }
+#endif
+    computeCrossProductsScalar(x, y, n, p1, p2, cross_products);
+}
+
+/// @brief Finds extreme points along x, y, x + y and x - y for n > 0 points, dispatched to the widest available
+/// instruction set
+template <typename T> ExtremePointIndices findExtremePoints(const T *x, const T *y, int n) noexcept
+{
+#if CONVEX_HULL_X86_SIMD
+    if constexpr (std::is_same<T, double>::value)
+    {
+        switch (getSimdLevel())
+        {
+        case SimdLevel::AVX512:
+            return findExtremePointsAvx512(x, y, n);
+        case SimdLevel::AVX2:
+            return findExtremePointsAvx2(x, y, n);
+        default:
+            break;
+        }
+    }
+#endif
+    return findExtremePointsScalar(x, y, n);
+}
+
+/// @brief Finds the next counterclockwise hull vertex after p among n points in Jarvis March (the point all others
+/// lie to the left of, farthest among collinear ones), dispatched to the widest available instruction set. Returns
+/// -1 if all points coincide with p.
+template <typename T> int findMostClockwisePoint(const T *x, const T *y, int n, int p) noexcept
+{
+    // Start from the first point that does not coincide with p
+    int q = 0;
+    while (q < n && x[q] == x[p] && y[q] == y[p])
+    {
+        ++q;
+    }
+    if (q == n)
+    {
+        return -1;
+    }
+
+#if CONVEX_HULL_X86_SIMD
+    if constexpr (std::is_same<T, double>::value)
+    {
+        switch (getSimdLevel())
+        {
+        case SimdLevel::AVX512:
+            return findMostClockwisePointAvx512(x, y, n, p, q);
+        case SimdLevel::AVX2:
+            return findMostClockwisePointAvx2(x, y, n, p, q);
+        default:
+            break;
+        }
+    }
+#endif
+    return findMostClockwisePointScalar(x, y, q + 1, n, p, q);
+}
+
+/// @brief Returns true if p lies inside or on the boundary of the counterclockwise convex polygon with h vertices
+/// stored in x and y, locating p in the fan of triangles around the first vertex in O(log h)
+template <typename T> bool isInsideConvexPolygon(const T *x, const T *y, int h, const Point<T> &p) noexcept
+{
+    if (h < 3)
+    {
+        // Empty polygon, single point or segment
+        if (h == 0)
+        {
+            return false;
+        }
+        const Point<T> a(x[0], y[0]);
+        const Point<T> b(x[h - 1], y[h - 1]);
+        return getOrientationSign(a, b, p) == 0 && std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+               std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+    }
+
+    const Point<T> origin(x[0], y[0]);
+    if (getOrientationSign(origin, Point<T>(x[1], y[1]), p) < 0 ||
+        getOrientationSign(origin, Point<T>(x[h - 1], y[h - 1]), p) > 0)
+    {
+        return false;
+    }
+
+    // Find the fan triangle (origin, low, low + 1) whose angular range contains p
+    int low = 1;
+    int high = h - 1;
+    while (high - low > 1)
+    {
+        const int middle = (low + high) / 2;
+        if (getOrientationSign(origin, Point<T>(x[middle], y[middle]), p) >= 0)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return getOrientationSign(Point<T>(x[low], y[low]), Point<T>(x[high], y[high]), p) >= 0;
+}
+
+/// @brief Returns number of fan bisection steps taken by the batched containment test of a polygon with h > 2 vertices
+inline int getConvexPolygonSearchSteps(int h) noexcept
+{
+    int steps = 0;
+    while ((1 << steps) < h - 2)
+    {
+        ++steps;
+    }
+    return steps;
+}
+
+#if CONVEX_HULL_X86_SIMD
+/// @brief Loads values at the lane indices, which are stored as doubles
+CONVEX_HULL_TARGET("avx2")
+inline __m256d gatherAvx2(const double *values, __m256d index) noexcept
+{
+    return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), values, _mm256_cvttpd_epi32(index),
+                                    _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+}
+
+CONVEX_HULL_TARGET("avx512f")
+inline __m512d gatherAvx512(const double *values, __m512d index) noexcept
+{
+    return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF,
+                                    _mm512_mask_cvttpd_epi32(_mm256_setzero_si256(), 0xFF, index), values, 8);
+}
+
+/// @brief Returns mask of lanes whose cross product left - right lies within the rounding error bound, which are
+/// tested again exactly
+CONVEX_HULL_TARGET("avx2")
+inline int getUncertainLanesAvx2(__m256d left, __m256d right, __m256d cross_product) noexcept
+{
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+    const __m256d bound =
+        _mm256_mul_pd(_mm256_set1_pd(getCrossProductErrorBound<double>()),
+                      _mm256_add_pd(_mm256_andnot_pd(sign_mask, left), _mm256_andnot_pd(sign_mask, right)));
+    return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(sign_mask, cross_product), bound, _CMP_LT_OQ));
+}
+
+CONVEX_HULL_TARGET("avx512f")
+inline __mmask8 getUncertainLanesAvx512(__m512d left, __m512d right, __m512d cross_product) noexcept
+{
+    const __m512d bound = _mm512_mul_pd(_mm512_set1_pd(getCrossProductErrorBound<double>()),
+                                        _mm512_add_pd(_mm512_abs_pd(left), _mm512_abs_pd(right)));
+    return _mm512_cmp_pd_mask(_mm512_abs_pd(cross_product), bound, _CMP_LT_OQ);
+}
+
+CONVEX_HULL_TARGET("avx2")
+inline void testPointsInConvexPolygonAvx2(const double *polygon_x, const double *polygon_y, int h, const double *x,
+                                          const double *y, int n, std::uint8_t *is_inside) noexcept
+{
+    const __m256d origin_x = _mm256_set1_pd(polygon_x[0]);
+    const __m256d origin_y = _mm256_set1_pd(polygon_y[0]);
+    const __m256d first_x = _mm256_set1_pd(polygon_x[1] - polygon_x[0]);
+    const __m256d first_y = _mm256_set1_pd(polygon_y[1] - polygon_y[0]);
+    const __m256d last_x = _mm256_set1_pd(polygon_x[h - 1] - polygon_x[0]);
+    const __m256d last_y = _mm256_set1_pd(polygon_y[h - 1] - polygon_y[0]);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d half = _mm256_set1_pd(0.5);
+    const int steps = getConvexPolygonSearchSteps(h);
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d x_i = _mm256_loadu_pd(x + i);
+        const __m256d y_i = _mm256_loadu_pd(y + i);
+        const __m256d px = _mm256_sub_pd(x_i, origin_x);
+        const __m256d py = _mm256_sub_pd(y_i, origin_y);
+
+        // Points to the right of the first fan edge or to the left of the last one are outside
+        const __m256d first_left = _mm256_mul_pd(first_x, py);
+        const __m256d first_right = _mm256_mul_pd(first_y, px);
+        const __m256d first_cross = _mm256_sub_pd(first_left, first_right);
+        const __m256d last_left = _mm256_mul_pd(last_x, py);
+        const __m256d last_right = _mm256_mul_pd(last_y, px);
+        const __m256d last_cross = _mm256_sub_pd(last_left, last_right);
+        const __m256d is_outside =
+            _mm256_or_pd(_mm256_cmp_pd(first_cross, zero, _CMP_LT_OQ), _mm256_cmp_pd(last_cross, zero, _CMP_GT_OQ));
+#if CONVEX_HULL_ROBUST_PREDICATES
+        int is_uncertain = getUncertainLanesAvx2(first_left, first_right, first_cross) |
+                           getUncertainLanesAvx2(last_left, last_right, last_cross);
+#endif
+
+        // Bisect the fan in lockstep, lanes that already found their triangle keep it
+        __m256d low = _mm256_set1_pd(1.0);
+        __m256d high = _mm256_set1_pd(static_cast<double>(h - 1));
+        for (int step = 0; step < steps; ++step)
+        {
+            const __m256d middle =
+                _mm256_round_pd(_mm256_mul_pd(_mm256_add_pd(low, high), half), _MM_FROUND_TO_NEG_INF);
+            const __m256d mx = _mm256_sub_pd(gatherAvx2(polygon_x, middle), origin_x);
+            const __m256d my = _mm256_sub_pd(gatherAvx2(polygon_y, middle), origin_y);
+            const __m256d left = _mm256_mul_pd(mx, py);
+            const __m256d right = _mm256_mul_pd(my, px);
+            const __m256d cross_product = _mm256_sub_pd(left, right);
+#if CONVEX_HULL_ROBUST_PREDICATES
+            is_uncertain |= getUncertainLanesAvx2(left, right, cross_product);
+#endif
+            const __m256d is_left = _mm256_cmp_pd(cross_product, zero, _CMP_GE_OQ);
+            low = _mm256_blendv_pd(low, middle, is_left);
+            high = _mm256_blendv_pd(middle, high, is_left);
+        }
+
+        // Points to the left of the outer edge of their triangle are inside
+        const __m256d lx = gatherAvx2(polygon_x, low);
+        const __m256d ly = gatherAvx2(polygon_y, low);
+        const __m256d ex = _mm256_sub_pd(gatherAvx2(polygon_x, high), lx);
+        const __m256d ey = _mm256_sub_pd(gatherAvx2(polygon_y, high), ly);
+        const __m256d left = _mm256_mul_pd(ex, _mm256_sub_pd(y_i, ly));
+        const __m256d right = _mm256_mul_pd(ey, _mm256_sub_pd(x_i, lx));
+        const __m256d cross_product = _mm256_sub_pd(left, right);
+#if CONVEX_HULL_ROBUST_PREDICATES
+        is_uncertain |= getUncertainLanesAvx2(left, right, cross_product);
+#endif
+        const int inside_lanes =
+            _mm256_movemask_pd(_mm256_andnot_pd(is_outside, _mm256_cmp_pd(cross_product, zero, _CMP_GE_OQ)));
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            is_inside[i + lane] = static_cast<std::uint8_t>((inside_lanes >> lane) & 1);
+#if CONVEX_HULL_ROBUST_PREDICATES
+            if ((is_uncertain >> lane) & 1)
+            {
+                is_inside[i + lane] = isInsideConvexPolygon(polygon_x, polygon_y, h,
+                                                            Point<double>(x[i + lane], y[i + lane]));
+            }
+#endif
+        }
+    }
+
+    for (; i < n; ++i)
+    {
+        is_inside[i] = isInsideConvexPolygon(polygon_x, polygon_y, h, Point<double>(x[i], y[i]));
+    }
+}
+
+CONVEX_HULL_TARGET("avx512f")
+inline void testPointsInConvexPolygonAvx512(const double *polygon_x, const double *polygon_y, int h, const double *x,
+                                            const double *y, int n, std::uint8_t *is_inside) noexcept
+{
+    const __m512d origin_x = _mm512_set1_pd(polygon_x[0]);
+    const __m512d origin_y = _mm512_set1_pd(polygon_y[0]);
+    const __m512d first_x = _mm512_set1_pd(polygon_x[1] - polygon_x[0]);
+    const __m512d first_y = _mm512_set1_pd(polygon_y[1] - polygon_y[0]);
+    const __m512d last_x = _mm512_set1_pd(polygon_x[h - 1] - polygon_x[0]);
+    const __m512d last_y = _mm512_set1_pd(polygon_y[h - 1] - polygon_y[0]);
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d half = _mm512_set1_pd(0.5);
+    const int steps = getConvexPolygonSearchSteps(h);
+
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m512d x_i = _mm512_loadu_pd(x + i);
+        const __m512d y_i = _mm512_loadu_pd(y + i);
+        const __m512d px = _mm512_sub_pd(x_i, origin_x);
+        const __m512d py = _mm512_sub_pd(y_i, origin_y);
+
+        // Points to the right of the first fan edge or to the left of the last one are outside
+        const __m512d first_left = _mm512_mul_pd(first_x, py);
+        const __m512d first_right = _mm512_mul_pd(first_y, px);
+        const __m512d first_cross = _mm512_sub_pd(first_left, first_right);
+        const __m512d last_left = _mm512_mul_pd(last_x, py);
+        const __m512d last_right = _mm512_mul_pd(last_y, px);
+        const __m512d last_cross = _mm512_sub_pd(last_left, last_right);
+        const __mmask8 is_outside =
+            _mm512_cmp_pd_mask(first_cross, zero, _CMP_LT_OQ) | _mm512_cmp_pd_mask(last_cross, zero, _CMP_GT_OQ);
+#if CONVEX_HULL_ROBUST_PREDICATES
+        __mmask8 is_uncertain = getUncertainLanesAvx512(first_left, first_right, first_cross) |
+                                getUncertainLanesAvx512(last_left, last_right, last_cross);
+#endif
+
+        // Bisect the fan in lockstep, lanes that already found their triangle keep it
+        __m512d low = _mm512_set1_pd(1.0);
+        __m512d high = _mm512_set1_pd(static_cast<double>(h - 1));
+        for (int step = 0; step < steps; ++step)
+        {
+            const __m512d middle = _mm512_mask_roundscale_pd(zero, 0xFF, _mm512_mul_pd(_mm512_add_pd(low, high), half),
+                                                             _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            const __m512d mx = _mm512_sub_pd(gatherAvx512(polygon_x, middle), origin_x);
+            const __m512d my = _mm512_sub_pd(gatherAvx512(polygon_y, middle), origin_y);
+            const __m512d left = _mm512_mul_pd(mx, py);
+            const __m512d right = _mm512_mul_pd(my, px);
+            const __m512d cross_product = _mm512_sub_pd(left, right);
+#if CONVEX_HULL_ROBUST_PREDICATES
+            is_uncertain |= getUncertainLanesAvx512(left, right, cross_product);
+#endif
+            const __mmask8 is_left = _mm512_cmp_pd_mask(cross_product, zero, _CMP_GE_OQ);
+            low = _mm512_mask_blend_pd(is_left, low, middle);
+            high = _mm512_mask_blend_pd(is_left, middle, high);
+        }
+
+        // Points to the left of the outer edge of their triangle are inside
+        const __m512d lx = gatherAvx512(polygon_x, low);
+        const __m512d ly = gatherAvx512(polygon_y, low);
+        const __m512d ex = _mm512_sub_pd(gatherAvx512(polygon_x, high), lx);
+        const __m512d ey = _mm512_sub_pd(gatherAvx512(polygon_y, high), ly);
+        const __m512d left = _mm512_mul_pd(ex, _mm512_sub_pd(y_i, ly));
+        const __m512d right = _mm512_mul_pd(ey, _mm512_sub_pd(x_i, lx));
+        const __m512d cross_product = _mm512_sub_pd(left, right);
+#if CONVEX_HULL_ROBUST_PREDICATES
+        is_uncertain |= getUncertainLanesAvx512(left, right, cross_product);
+#endif
+        const __mmask8 inside_lanes = ~is_outside & _mm512_cmp_pd_mask(cross_product, zero, _CMP_GE_OQ);
+        for (int lane = 0; lane < 8; ++lane)
+        {
+            is_inside[i + lane] = static_cast<std::uint8_t>((inside_lanes >> lane) & 1);
+#if CONVEX_HULL_ROBUST_PREDICATES
+            if ((is_uncertain >> lane) & 1)
+            {
+                is_inside[i + lane] = isInsideConvexPolygon(polygon_x, polygon_y, h,
+                                                            Point<double>(x[i + lane], y[i + lane]));
+            }
+#endif
+        }
+    }
+
+    for (; i < n; ++i)
+    {
+        is_inside[i] = isInsideConvexPolygon(polygon_x, polygon_y, h, Point<double>(x[i], y[i]));
+    }
+}
+#endif
+
+/// @brief Batched containment test of n points against the counterclockwise convex polygon with h vertices, storing 1
+/// for points inside or on the boundary and 0 otherwise, dispatched to the widest available instruction set
+template <typename T>
+void testPointsInConvexPolygon(const T *polygon_x, const T *polygon_y, int h, const T *x, const T *y, int n,
+                               std::uint8_t *is_inside) noexcept
+{
+#if CONVEX_HULL_X86_SIMD
+    if constexpr (std::is_same<T, double>::value)
+    {
+        if (h > 2)
+        {
+            switch (getSimdLevel())
+            {
+            case SimdLevel::AVX512:
+                return testPointsInConvexPolygonAvx512(polygon_x, polygon_y, h, x, y, n, is_inside);
+            case SimdLevel::AVX2:
+                return testPointsInConvexPolygonAvx2(polygon_x, polygon_y, h, x, y, n, is_inside);
+            default:
+                break;
+            }
+        }
+    }
+#endif
+    for (int i = 0; i < n; ++i)
+    {
+        is_inside[i] = isInsideConvexPolygon(polygon_x, polygon_y, h, Point<T>(x[i], y[i]));
+    }
+}
+
+/// @brief Pending Quickhull subproblem: points [first, last) of the index buffer lie strictly to the right of the
+/// directed edge (p, q). A negative first marks a hull vertex p to be emitted.
+struct QuickhullFrame
+{
+    int first, last, p, q;
+};
+
+/// @brief Root pass of the parallel Quickhull over a chunk of points: the lexicographically smallest and largest
+/// points of the chunk, and the number of its points strictly below and above the line through those of all points
+struct QuickhullChunk
+{
+    int a, b, lower_size, upper_size;
+};
+
+/// @brief Smallest number of points per chunk, and smallest subproblem, that Quickhull splits across threads
+constexpr int min_parallel_quickhull_size = 1 << 15;
+
+/// @brief Point of a set copied next to its index, so that hulls of small sets sort and scan contiguous memory
+template <typename T> struct IndexedPoint
+{
+    T x, y;
+    int index;
+
+    Point<T> getPoint() const noexcept
+    {
+        return Point<T>(x, y);
+    }
+};
+
+/// @brief Scratch buffers of a block of point sets of constructConvexHulls
+template <typename T> struct ConvexHullBlockBuffers
+{
+    std::vector<Point<T>> polygon;       // Extreme point polygon of the interior point filter
+    std::vector<IndexedPoint<T>> points; // Points of the current set that survived the filter
+};
+
+class ConvexHullThreadPool;
+
+/// @brief Smallest range that is ordered by radix sort rather than by comparison sort
+constexpr int min_radix_sort_size = 1 << 11;
+
+/// @brief Shortest average run of hull vertices that is merged rather than radix sorted, as every pass of the merge
+/// halves the number of runs
+constexpr int min_merge_run_length = 16;
+
+/// @brief Sort key with the point index carried along as payload
+struct RadixSortItem
+{
+    std::uint64_t key;
+    int index;
+};
+
+/// @brief Maps a coordinate to an unsigned key of the same order, where -0 and +0 are mapped alike. Floating-point
+/// types wider than double are rounded to double, which keeps the order but may merge keys.
+template <typename T> std::uint64_t getRadixKey(T value) noexcept
+{
+    if constexpr (std::is_floating_point<T>::value && sizeof(T) > sizeof(double))
+    {
+        return getRadixKey(static_cast<double>(value));
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        using Bits = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+        constexpr Bits sign_bit = Bits(1) << (8 * sizeof(Bits) - 1);
+        const T normalized = value + T(0);
+        Bits bits;
+        std::memcpy(&bits, &normalized, sizeof(bits));
+        return (bits & sign_bit) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | sign_bit);
+    }
+    else if constexpr (std::is_signed<T>::value)
+    {
+        using Bits = std::make_unsigned_t<T>;
+        return static_cast<Bits>(static_cast<Bits>(value) ^ (Bits(1) << (8 * sizeof(T) - 1)));
+    }
+    else
+    {
+        return static_cast<std::uint64_t>(value);
+    }
+}
+
+/// @brief Returns radix key ordered like (y, x) for coordinates of up to 32 bits, and like y for wider coordinates
+template <typename T> std::uint64_t getLexicographicRadixKey(T x, T y) noexcept
+{
+    if constexpr (sizeof(T) <= sizeof(std::uint32_t))
+    {
+        return (getRadixKey(y) << 32) | getRadixKey(x);
+    }
+    else
+    {
+        return getRadixKey(y);
+    }
+}
+
+/// @brief Sorts items by key with a stable LSD radix sort over 11-bit digits, skipping digits shared by all keys.
+/// Scratch holds as many items as the input, and the returned pointer is whichever of the two holds the result.
+inline RadixSortItem *sortRadixItems(RadixSortItem *items, RadixSortItem *scratch, int n) noexcept
+{
+    constexpr int digit_bits = 11;
+    constexpr int number_of_digits = (64 + digit_bits - 1) / digit_bits;
+    constexpr int number_of_buckets = 1 << digit_bits;
+    constexpr std::uint64_t digit_mask = number_of_buckets - 1;
+    if (n < 2)
+    {
+        return items;
+    }
+
+    // Count all digits in a single pass over the keys
+    int counts[number_of_digits][number_of_buckets] = {};
+    for (int i = 0; i < n; ++i)
+    {
+        const std::uint64_t key = items[i].key;
+        for (int digit = 0; digit < number_of_digits; ++digit)
+        {
+            ++counts[digit][(key >> (digit * digit_bits)) & digit_mask];
+        }
+    }
+
+    for (int digit = 0; digit < number_of_digits; ++digit)
+    {
+        const int shift = digit * digit_bits;
+        int *const offsets = counts[digit];
+        if (offsets[(items[0].key >> shift) & digit_mask] == n)
+        {
+            continue;
+        }
+
+        // Turn counts into bucket offsets, and scatter items into their buckets, keeping the order within buckets
+        for (int bucket = 0, offset = 0; bucket < number_of_buckets; ++bucket)
+        {
+            const int count = offsets[bucket];
+            offsets[bucket] = offset;
+            offset += count;
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            scratch[offsets[(items[i].key >> shift) & digit_mask]++] = items[i];
+        }
+        std::swap(items, scratch);
+    }
+    return items;
+}
+
+/// @brief Selection thresholds of ConvexHullAlgorithm::AUTO, which compares the input size and estimates from a sample
+/// of the points against them. The defaults were measured on a desktop x86 CPU, calibrateConvexHullAutoThresholds
+/// derives them for the running machine.
+struct ConvexHullAutoThresholds
+{
+    int max_small_size = 128;            // Largest input hulled by Andrew's Monotone Chain without sampling
+    int sample_size = 256;               // Number of points sampled at a fixed stride
+    int min_filter_size = 512;           // Smallest input for which the octagon filter is applied
+    double max_filter_fraction = 0.9;    // Sampled octagon filter survivor fraction below which the filter is applied
+    double max_quickhull_fraction = 0.2; // Sampled survivor fraction below which Quickhull is preferred to Andrew's
+                                         // Monotone Chain
+    int min_parallel_size = 1 << 20;     // Smallest input for which a parallel algorithm is used, given more than one
+                                         // hardware thread
+};
+
+/// @brief Lowest and highest point of a vertical strip of ConvexHullAlgorithm::APPROXIMATE, and the x-range of all
+/// points assigned to the strip
+template <typename T> struct ConvexHullStrip
+{
+    int bottom = -1; // Index of the lowest point, or -1 if the strip is empty
+    int top = -1;    // Index of the highest point
+    T bottom_y{}, top_y{};
+    T min_x{}, max_x{};
+};
+
+/// @brief Hull vertex copied out of the input points to be merged, together with its input index
+template <typename T> struct ConvexHullMergeVertex
+{
+    Point<T> point;
+    int index;
+};
+
+/// @brief Scratch buffers of a merge of hulls
+template <typename T> struct ConvexHullMergeBuffers
+{
+    std::vector<ConvexHullMergeVertex<T>> vertices; // Runs ascending in (y, x, index) order
+    std::vector<ConvexHullMergeVertex<T>> scratch;  // Scratch of the merge passes
+    std::vector<int> run_ends;                      // Ends of the runs in vertices
+    std::vector<int> positions;                     // Positions of merged vertices ordered by the monotone chain
+
+    /// @brief Returns total capacity of the buffers, which grows whenever one of them does
+    std::size_t capacity() const noexcept
+    {
+        return vertices.capacity() + scratch.capacity() + run_ends.capacity() + positions.capacity();
+    }
+};
+
+/// @brief Scratch buffers reused across convex hull constructions. Once the buffers have grown to the input size,
+/// repeated constructions with the same workspace and output vector make no heap allocations.
+template <typename T> struct ConvexHullWorkspace
+{
+    std::vector<int> indices;                             // Permutation of point indices sorted by the algorithms
+    std::vector<int> subset_hulls;                        // Concatenated subset hulls of Chan's algorithm
+    std::vector<int> subset_offsets;                      // Offsets of subset hulls of Chan's algorithm
+    std::vector<std::vector<int>> chunk_hulls;            // Chunk hulls of the parallel algorithm
+    std::vector<ConvexHullMergeBuffers<T>> chunk_merges;  // Merge buffers of the parallel algorithm
+    std::vector<int> survivor_indices;                    // Indices of points that survived interior point filtering
+    std::vector<Point<T>> survivors;                      // Points that survived interior point filtering
+    PointArray<T> survivor_array;                         // Structure-of-arrays points that survived interior point
+                                                          // filtering
+    std::vector<Point<T>> polygon;                        // Extreme point polygon of the interior point filter
+    std::vector<QuickhullFrame> frames;                   // Pending subproblems of Quickhull
+    std::vector<RadixSortItem> radix_items;               // Keys and scratch of the radix sort
+    std::vector<ConvexHullStrip<T>> strips;               // Vertical strips of the approximate hull
+    std::vector<QuickhullChunk> quickhull_chunks;         // Chunks of the root pass of the parallel Quickhull
+    std::vector<std::vector<QuickhullFrame>> task_frames; // Pending subproblems of tasks of the parallel Quickhull
+    std::vector<char> task_done;                          // Completion flags of dependent parallel tasks
+    std::vector<ConvexHullBlockBuffers<T>> blocks;        // Buffers of blocks of point sets of constructConvexHulls
+    ConvexHullMergeBuffers<T> merge_buffers;              // Buffers of mergeConvexHulls
+    ConvexHullThreadPool *thread_pool = nullptr;          // Pool of the parallel algorithms, the default pool if null
+    ConvexHullStats *stats = nullptr;                     // Optional stats filled by each construction
+    ConvexHullAutoThresholds auto_thresholds;             // Thresholds of ConvexHullAlgorithm::AUTO
+    int approximation_strips = 1 << 10;                   // Strips of ConvexHullAlgorithm::APPROXIMATE
+    Real<T> approximation_error = 0;                      // Distance within which the last approximate hull
+                                                          // contains every input point
+};
+
+#if CONVEX_HULL_STATS
+/// @brief Collects stats of a construction into workspace.stats for its lifetime. Only the outermost scope on a
+/// thread times stages and counts buffer growth, nested scopes of algorithms it dispatches to record the algorithm.
+template <typename T> class ConvexHullStatsScope
+{
+  public:
+    ConvexHullStatsScope(ConvexHullWorkspace<T> &workspace, const std::vector<int> &hull_indices,
+                         ConvexHullAlgorithm algorithm, std::size_t number_of_points)
+        : workspace_(workspace), hull_indices_(hull_indices), is_outermost_(false)
+    {
+        auto &state = getConvexHullStatsState();
+        if (workspace.stats == nullptr || (state.stats != nullptr && state.stats != workspace.stats))
+        {
+            return;
+        }
+        workspace.stats->algorithm = algorithm;
+        if (state.stats != nullptr)
+        {
+            return;
+        }
+
+        is_outermost_ = true;
+        *workspace.stats = ConvexHullStats();
+        workspace.stats->algorithm = algorithm;
+        workspace.stats->number_of_points = static_cast<long long>(number_of_points);
+        capacities_ = getCapacities();
+        getCapacities(workspace.chunk_hulls, chunk_hull_capacities_);
+        getCapacities(workspace.chunk_merges, chunk_merge_capacities_);
+        state = ConvexHullStatsState();
+        state.stats = workspace.stats;
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    ~ConvexHullStatsScope()
+    {
+        if (!is_outermost_)
+        {
+            return;
+        }
+
+        auto &state = getConvexHullStatsState();
+        const auto now = std::chrono::steady_clock::now();
+        if (state.stage >= 0)
+        {
+            state.stats->stage_seconds[state.stage] += std::chrono::duration<double>(now - state.stage_start).count();
+        }
+        state.stats->total_seconds = std::chrono::duration<double>(now - start_).count();
+        state.stats->hull_size = static_cast<long long>(hull_indices_.size());
+        const auto capacities = getCapacities();
+        for (std::size_t i = 0; i < capacities.size(); ++i)
+        {
+            state.stats->number_of_allocations += capacities[i] > capacities_[i];
+        }
+        state.stats->number_of_allocations += countGrownBuffers(chunk_hull_capacities_, workspace_.chunk_hulls) +
+                                              countGrownBuffers(chunk_merge_capacities_, workspace_.chunk_merges);
+        state = ConvexHullStatsState();
+    }
+
+    ConvexHullStatsScope(const ConvexHullStatsScope &) = delete;
+    ConvexHullStatsScope &operator=(const ConvexHullStatsScope &) = delete;
+
+  private:
+    /// @brief Returns capacities of the workspace and output buffers, excluding chunk hulls
+    std::array<std::size_t, 15> getCapacities() const noexcept
+    {
+        return {workspace_.indices.capacity(),          workspace_.subset_hulls.capacity(),
+                workspace_.subset_offsets.capacity(),   workspace_.chunk_hulls.capacity(),
+                workspace_.chunk_merges.capacity(),     workspace_.survivor_indices.capacity(),
+                workspace_.survivors.capacity(),        workspace_.survivor_array.x.capacity(),
+                workspace_.survivor_array.y.capacity(), workspace_.polygon.capacity(),
+                workspace_.frames.capacity(),           workspace_.radix_items.capacity(),
+                workspace_.strips.capacity(),           workspace_.merge_buffers.capacity(),
+                hull_indices_.capacity()};
+    }
+
+    template <typename Chunks> static void getCapacities(const Chunks &chunks, std::vector<std::size_t> &capacities)
+    {
+        capacities.clear();
+        for (const auto &chunk : chunks)
+        {
+            capacities.push_back(chunk.capacity());
+        }
+    }
+
+    /// @brief Returns number of buffers whose capacity exceeds the recorded one
+    template <typename Capacities, typename Chunks>
+    static long long countGrownBuffers(const Capacities &capacities, const Chunks &chunks) noexcept
+    {
+        long long count = 0;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            count += chunks[i].capacity() > (i < capacities.size() ? capacities[i] : 0);
+        }
+        return count;
+    }
+
+    ConvexHullWorkspace<T> &workspace_;
+    const std::vector<int> &hull_indices_;
+    bool is_outermost_;
+    std::array<std::size_t, 15> capacities_{};
+    std::vector<std::size_t> chunk_hull_capacities_, chunk_merge_capacities_;
+    std::chrono::steady_clock::time_point start_;
+};
+#endif
+
+/// @brief Reverses counterclockwise hull if CLOCKWISE orientation is requested, and closes it if ENCLOSED
+template <typename Index>
+void applyOrientationAndReturnType(std::vector<Index> &hull_indices, Orientation orientation,
+                                   ConvexHullReturnType return_type)
+{
+    CONVEX_HULL_STAGE(FINALIZE);
+
+    // Check orientation, and reverse order if orientation set to CLOCKWISE
+    if (orientation == Orientation::CLOCKWISE)
+    {
+        std::reverse(hull_indices.begin(), hull_indices.end());
+    }
+
+    // Check if hull should be enclosed
+    if (return_type == ConvexHullReturnType::ENCLOSED && !hull_indices.empty())
+    {
+        hull_indices.push_back(hull_indices[0]);
+    }
+}
+
+/// @brief Orders indices [first, last) by polar angle around ref, which is lowest of all points, like
+/// comparePolarAngle. Items are radix sorted by the pseudo-angle -dx / (|dx| + dy), which grows with the angle and is
+/// rounded by a few units in the last place, then runs of consecutive keys closer than that are sorted exactly with
+/// comparePolarAngle. Returns false, leaving the range unchanged, if differences of coordinates wider than 32-bit
+/// integers or double may be rounded, or if they overflow. Requires a buffer of 2 * (last - first) radix_items.
+template <typename T, typename Points>
+bool sortByPseudoAngle(const Points &points, const Point<T> &ref, int *first, int *last, RadixSortItem *radix_items)
+{
+    if constexpr ((std::is_integral<T>::value && sizeof(T) > sizeof(std::int32_t)) || sizeof(T) > sizeof(double))
+    {
+        return false;
+    }
+    else
+    {
+        // Keys within this many units in the last place of each other may be ordered wrongly
+        constexpr std::uint64_t max_key_error = 64;
+
+        const int n = static_cast<int>(last - first);
+        const double ref_x = static_cast<double>(ref.x);
+        const double ref_y = static_cast<double>(ref.y);
+        for (int i = 0; i < n; ++i)
+        {
+            const auto &point = points[first[i]];
+            const double dx = static_cast<double>(point.x) - ref_x;
+            const double dy = static_cast<double>(point.y) - ref_y;
+            const double length = std::fabs(dx) + dy;
+            if (!std::isfinite(length))
+            {
+                return false;
+            }
+
+            // Duplicates of the reference point come first
+            radix_items[i] = {getRadixKey((length > 0) ? -dx / length : -2.0), first[i]};
+        }
+
+        const RadixSortItem *const items = sortRadixItems(radix_items, radix_items + n, n);
+        for (int i = 0; i < n;)
+        {
+            int run_end = i;
+            do
+            {
+                first[run_end] = items[run_end].index;
+                ++run_end;
+            } while (run_end < n && items[run_end].key - items[run_end - 1].key <= max_key_error);
+            if (run_end - i > 1)
+            {
+                std::sort(first + i, first + run_end, [&](int i1, int i2) noexcept -> bool {
+                    return comparePolarAngle(ref, points[i1], points[i2]);
+                });
+            }
+            i = run_end;
+        }
+        return true;
+    }
+}
+
+/// @brief Return convex hull indices calculated using Graham-Andrew algorithm
+template <typename T, typename Points>
+void constructGrahamScanConvexHull(const Points &points, Orientation orientation, ConvexHullReturnType return_type,
+                                   ConvexHullWorkspace<T> &workspace, std::vector<int> &hull_indices)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, ConvexHullAlgorithm::GRAHAM_SCAN, points.size());
+    hull_indices.clear();
+    int n = static_cast<int>(points.size());
+    if (n < 3)
+    {
+        // Convex Hull is not possible for less than 3 points
+        return;
+    }
+
+    // Find point with the lowest y-coordinate (and lowest x coordinate if there is a tie)
+    CONVEX_HULL_STAGE(SORT);
+    int min_index = 0;
+    for (int i = 1; i < n; ++i)
+    {
+        if (points[i] < points[min_index])
+        {
+            min_index = i;
+        }
+    }
+
+    // Sort a permutation of indices rather than the points themselves, so that original indices are carried
+    // through the sort and no back-mapping is required
+    auto &sorted_indices = workspace.indices;
+    sorted_indices.resize(n);
+    std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
+    std::swap(sorted_indices[0], sorted_indices[min_index]);
+
+    // Sort the remaining points based on their polar angle with respect to the reference point, by radix sort for
+    // large inputs
+    const Point<T> &ref_point = points[min_index];
+    if (n - 1 >= min_radix_sort_size)
+    {
+        workspace.radix_items.resize(2 * (n - 1));
+    }
+    if (n - 1 < min_radix_sort_size || !sortByPseudoAngle(points, ref_point, sorted_indices.data() + 1,
+                                                          sorted_indices.data() + n, workspace.radix_items.data()))
+    {
+        std::sort(sorted_indices.begin() + 1, sorted_indices.end(), [&](int i1, int i2) noexcept -> bool {
+            return comparePolarAngle(ref_point, points[i1], points[i2]);
+        });
+    }
+
+    // Initialize the convex hull with the first two sorted points, the third one may already be collinear with them
+    hull_indices.reserve(n + 1);
+    CONVEX_HULL_STAGE(SCAN);
+    hull_indices.insert(hull_indices.end(), sorted_indices.begin(), sorted_indices.begin() + 2);
+    int hull_size = 2;
+
+    // Process remaining points
+    for (int i = 2; i < n; ++i)
+    {
+        const int current = sorted_indices[i];
+
+        // Remove the last point from the hull while it makes a clockwise turn with the next point
+        while (hull_size >= 2 &&
+               getOrientation(points[hull_indices[hull_size - 2]], points[hull_indices[hull_size - 1]],
+                              points[current]) != Orientation::COUNTERCLOCKWISE)
+        {
+            hull_indices.pop_back();
+            --hull_size;
+            CONVEX_HULL_COUNT(number_of_hull_pops, 1);
+        }
+
+        // Add the next point index to the hull
+        hull_indices.push_back(current);
+        ++hull_size;
+    }
+
+    // Points that all coincide leave the reference point and the last one, report them as a single vertex like the
+    // other algorithms
+    if (hull_size == 2 && points[hull_indices[0]] == points[hull_indices[1]])
+    {
+        hull_indices.pop_back();
+    }
+
+    applyOrientationAndReturnType(hull_indices, orientation, return_type);
+}
+
+/// @brief Return convex hull indices calculated using Graham-Andrew algorithm
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructGrahamScanConvexHull(const Points &points, Orientation orientation,
+                                               ConvexHullReturnType return_type)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructGrahamScanConvexHull(points, orientation, return_type, workspace, hull_indices);
+    return hull_indices;
+}
+
+/// @brief Orders the index range [first, last) lexicographically for Andrew's Monotone Chain algorithm, with ties
+/// broken by index, so that the same duplicate survives regardless of how the input was partitioned. Ranges already
+/// ordered by (y, x) or (x, y), ascending or descending, such as scanlines and sampled polylines, are detected in O(n)
+/// and kept in their order rather than sorted, since the chains can be built along either axis. Large ranges are
+/// radix sorted if a buffer of 2 * (last - first) radix_items is given. Returns true if the range is ordered by (x, y).
+template <typename Points>
+bool orderMonotoneChainRange(const Points &points, int *first, int *last, RadixSortItem *radix_items = nullptr)
+{
+    const auto is_less = [&](int i1, int i2) noexcept -> bool {
+        return points[i1] < points[i2] || (!(points[i2] < points[i1]) && i1 < i2);
+    };
+    const auto is_less_xy = [&](int i1, int i2) noexcept -> bool {
+        const auto &p1 = points[i1];
+        const auto &p2 = points[i2];
+        return p1.x < p2.x || (p1.x == p2.x && (p1.y < p2.y || (p1.y == p2.y && i1 < i2)));
+    };
+
+    // Descending orders keep duplicates ascending by index, as they appear in the input
+    const auto is_greater = [&](int i1, int i2) noexcept -> bool {
+        return points[i2] < points[i1] || (!(points[i1] < points[i2]) && i1 < i2);
+    };
+    const auto is_greater_xy = [&](int i1, int i2) noexcept -> bool {
+        const auto &p1 = points[i1];
+        const auto &p2 = points[i2];
+        return p2.x < p1.x || (p1.x == p2.x && (p2.y < p1.y || (p1.y == p2.y && i1 < i2)));
+    };
+
+    // Reverses a descending range, then reverses each run of duplicates back to ascending index order
+    const auto reverse = [&]() noexcept {
+        std::reverse(first, last);
+        for (int *run = first; run != last;)
+        {
+            int *run_end = run + 1;
+            while (run_end != last && points[*run_end] == points[*run])
+            {
+                ++run_end;
+            }
+            std::reverse(run, run_end);
+            run = run_end;
+        }
+    };
+
+    // Unsorted ranges fail each check within the first few elements
+    if (std::is_sorted(first, last, is_less))
+    {
+        return false;
+    }
+    if (std::is_sorted(first, last, is_less_xy))
+    {
+        return true;
+    }
+    if (std::is_sorted(first, last, is_greater))
+    {
+        reverse();
+        return false;
+    }
+    if (std::is_sorted(first, last, is_greater_xy))
+    {
+        reverse();
+        return true;
+    }
+
+    const int n = static_cast<int>(last - first);
+    if (radix_items != nullptr && n >= min_radix_sort_size)
+    {
+        // Radix sort by keys ordered like (y, x), or like y for coordinates wider than 32 bits, then sort runs of equal
+        // keys exactly, which orders them by x if needed and duplicates by index
+        for (int i = 0; i < n; ++i)
+        {
+            const auto &point = points[first[i]];
+            radix_items[i] = {getLexicographicRadixKey(point.x, point.y), first[i]};
+        }
+        const RadixSortItem *const items = sortRadixItems(radix_items, radix_items + n, n);
+        for (int i = 0; i < n;)
+        {
+            int run_end = i;
+            for (; run_end < n && items[run_end].key == items[i].key; ++run_end)
+            {
+                first[run_end] = items[run_end].index;
+            }
+            if (run_end - i > 1)
+            {
+                std::sort(first + i, first + run_end, is_less);
+            }
+            i = run_end;
+        }
+    }
+    else if (n <= 32)
+    {
+        // Small ranges are sorted with insertion sort, which avoids the setup cost of introsort
+        for (int *it = first + 1; it != last; ++it)
+        {
+            const int index = *it;
+            int *hole = it;
+            for (; hole != first && is_less(index, *(hole - 1)); --hole)
+            {
+                *hole = *(hole - 1);
+            }
+            *hole = index;
+        }
+    }
+    else
+    {
+        std::sort(first, last, is_less);
+    }
+    return false;
+}
+
+/// @brief Appends counterclockwise hull of the points referenced by [first, last) to hull_indices using Andrew's
+/// Monotone Chain algorithm, the index range is sorted in place unless it is already ordered along an axis. Large
+/// ranges are radix sorted if a buffer of 2 * (last - first) radix_items is given.
+template <typename Points>
+void appendMonotoneChainConvexHull(const Points &points, int *first, int *last, std::vector<int> &hull_indices,
+                                   RadixSortItem *radix_items = nullptr)
+{
+    const int n = static_cast<int>(last - first);
+    if (n < 2)
+    {
+        hull_indices.insert(hull_indices.end(), first, last);
+        return;
+    }
+
+    // Order a permutation of indices, so that original indices are carried through the sort
+    CONVEX_HULL_STAGE(SORT);
+    const bool is_x_major = orderMonotoneChainRange(points, first, last, radix_items);
+    CONVEX_HULL_STAGE(SCAN);
+
+    // Preallocate hull after already stored vertices
+    const auto offset = hull_indices.size();
+    hull_indices.resize(offset + 2 * n);
+    int *hull = hull_indices.data() + offset;
+
+    // Compute lower hull
+    int k = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        const int current = first[i];
+        while (k >= 2 && getOrientation(points[hull[k - 2]], points[hull[k - 1]], points[current]) !=
+                             Orientation::COUNTERCLOCKWISE)
+        {
+            --k;
+            CONVEX_HULL_COUNT(number_of_hull_pops, 1);
+        }
+        hull[k++] = current;
+    }
+
+    // Compute upper hull
+    for (int i = n - 2, t = k + 1; i >= 0; --i)
+    {
+        const int current = first[i];
+        while (k >= t && getOrientation(points[hull[k - 2]], points[hull[k - 1]], points[current]) !=
+                             Orientation::COUNTERCLOCKWISE)
+        {
+            --k;
+            CONVEX_HULL_COUNT(number_of_hull_pops, 1);
+        }
+        hull[k++] = current;
+    }
+
+    // Chains built along x start at the leftmost vertex, rotate the hull to start at the lowest one instead
+    if (is_x_major)
+    {
+        std::rotate(hull, std::min_element(hull, hull + k - 1, [&](int i1, int i2) noexcept -> bool {
+                        return points[i1] < points[i2];
+                    }),
+                    hull + k - 1);
+    }
+
+    // Points that all coincide collapse both chains onto the first and the last point, keep a single vertex
+    if (k == 3 && points[hull[0]] == points[hull[1]])
+    {
+        k = 2;
+    }
+
+    // Resize convex hull to contain only required points
+    hull_indices.resize(offset + k - 1);
+}
+
+/// @brief Appends the vertices of a hull of the given size to buffers as at most 2 runs ascending in (y, x, index)
+/// order. Vertices of a convex polygon ascend along both sides from the lowest vertex to the highest one, so one run
+/// follows each side. The hull may have either orientation, and may be enclosed by repeating its first vertex.
+template <typename T, typename Points>
+void appendConvexHullMergeRuns(const Points &points, const int *hull, int size, ConvexHullMergeBuffers<T> &buffers)
+{
+    if (size > 1 && hull[size - 1] == hull[0])
+    {
+        --size;
+    }
+    if (size <= 0)
+    {
+        return;
+    }
+
+    const auto is_less = [&](int i1, int i2) noexcept -> bool {
+        return points[i1] < points[i2] || (!(points[i2] < points[i1]) && i1 < i2);
+    };
+    int low = 0;
+    int high = 0;
+    for (int i = 1; i < size; ++i)
+    {
+        low = is_less(hull[i], hull[low]) ? i : low;
+        high = is_less(hull[high], hull[i]) ? i : high;
+    }
+
+    // The first run goes counterclockwise, which is the direction of the left turn at the lowest vertex, and the
+    // second one goes clockwise from the vertex before the lowest one
+    const int previous = hull[(low + size - 1) % size];
+    const int next = hull[(low + 1) % size];
+    int step = (size < 3 || getOrientationSign(points[previous], points[hull[low]], points[next]) >= 0) ? 1 : -1;
+    const int length = ((high - low) * step + size) % size + 1;
+    auto &vertices = buffers.vertices;
+    for (int i = 0, position = low; i < size; ++i, position = (position + step + size) % size)
+    {
+        if (i == length)
+        {
+            buffers.run_ends.push_back(static_cast<int>(vertices.size()));
+            position = (low - step + size) % size;
+            step = -step;
+        }
+        vertices.push_back({points[hull[position]], hull[position]});
+    }
+    buffers.run_ends.push_back(static_cast<int>(vertices.size()));
+}
+
+/// @brief Appends counterclockwise hull of the union of hulls, given by their runs in buffers, to hull_indices, and
+/// clears the runs. Pairs of adjacent runs are merged until one remains, in O(H log k) time for H vertices in k runs,
+/// and the merged vertices are already ordered, so the monotone chain scans them without sorting. Given a buffer of
+/// 2 * H radix_items, runs too short to be merged efficiently are radix sorted instead.
+template <typename T>
+void appendMergedConvexHull(ConvexHullMergeBuffers<T> &buffers, std::vector<int> &hull_indices,
+                            RadixSortItem *radix_items = nullptr)
+{
+    CONVEX_HULL_STAGE(MERGE);
+    const auto is_less = [](const ConvexHullMergeVertex<T> &v1, const ConvexHullMergeVertex<T> &v2) noexcept -> bool {
+        const auto &p1 = v1.point;
+        const auto &p2 = v2.point;
+        return p1.y < p2.y || (p1.y == p2.y && (p1.x < p2.x || (p1.x == p2.x && v1.index < v2.index)));
+    };
+
+    auto &vertices = buffers.vertices;
+    auto &scratch = buffers.scratch;
+    auto &run_ends = buffers.run_ends;
+    const int n = static_cast<int>(vertices.size());
+    if (n == 0)
+    {
+        run_ends.clear();
+        return;
+    }
+
+    // Runs are merged back and forth between the vertex and scratch buffers, without branching on the comparisons
+    ConvexHullMergeVertex<T> *source = vertices.data();
+    if (radix_items == nullptr || n >= min_merge_run_length * static_cast<long long>(run_ends.size()))
+    {
+        radix_items = nullptr;
+        scratch.resize(n);
+        ConvexHullMergeVertex<T> *target = scratch.data();
+        while (run_ends.size() > 1)
+        {
+            std::size_t number_of_runs = 0;
+            for (std::size_t run_no = 0; run_no < run_ends.size(); run_no += 2)
+            {
+                const int first = (run_no == 0) ? 0 : run_ends[run_no - 1];
+                const int last = (run_no + 1 < run_ends.size()) ? run_ends[run_no + 1] : run_ends[run_no];
+                const ConvexHullMergeVertex<T> *first1 = source + first;
+                const ConvexHullMergeVertex<T> *last1 = source + run_ends[run_no];
+                const ConvexHullMergeVertex<T> *first2 = last1;
+                const ConvexHullMergeVertex<T> *last2 = source + last;
+                ConvexHullMergeVertex<T> *output = target + first;
+                while (first1 != last1 && first2 != last2)
+                {
+                    const bool is_second = is_less(*first2, *first1);
+                    *output++ = is_second ? *first2 : *first1;
+                    first2 += is_second;
+                    first1 += !is_second;
+                }
+                output = std::copy(first1, last1, output);
+                std::copy(first2, last2, output);
+                run_ends[number_of_runs++] = last;
+            }
+            run_ends.resize(number_of_runs);
+            std::swap(source, target);
+        }
+    }
+
+    // Scan the vertices through a view, so that their points are read from the buffer rather than the input
+    const PointView<T> merged_points(&source->point.x, &source->point.y, static_cast<std::size_t>(n),
+                                     sizeof(ConvexHullMergeVertex<T>));
+    auto &positions = buffers.positions;
+    positions.resize(n);
+    std::iota(positions.begin(), positions.end(), 0);
+    const auto offset = hull_indices.size();
+    appendMonotoneChainConvexHull(merged_points, positions.data(), positions.data() + n, hull_indices, radix_items);
+    for (auto i = offset; i < hull_indices.size(); ++i)
+    {
+        hull_indices[i] = source[hull_indices[i]].index;
+    }
+
+    vertices.clear();
+    run_ends.clear();
+}
+
+/// @brief Andrew's Monotone Chain convex hull algorithm
+template <typename T, typename Points>
+void constructAndrewMonotoneChainConvexHull(const Points &points, Orientation orientation,
+                                            ConvexHullReturnType return_type, ConvexHullWorkspace<T> &workspace,
+                                            std::vector<int> &hull_indices)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, points.size());
+    hull_indices.clear();
+    int n = static_cast<int>(points.size());
+    if (n < 3)
+    {
+        // Convex Hull is not possible for less than 3 points
+        return;
+    }
+
+    // Sort a permutation of indices and compute counterclockwise hull
+    auto &sorted_indices = workspace.indices;
+    sorted_indices.resize(n);
+    std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
+    workspace.radix_items.resize(2 * n);
+    appendMonotoneChainConvexHull(points, sorted_indices.data(), sorted_indices.data() + n, hull_indices,
+                                  workspace.radix_items.data());
+
+    applyOrientationAndReturnType(hull_indices, orientation, return_type);
+}
+
+/// @brief Andrew's Monotone Chain convex hull algorithm
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructAndrewMonotoneChainConvexHull(const Points &points, Orientation orientation,
+                                                        ConvexHullReturnType return_type)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructAndrewMonotoneChainConvexHull(points, orientation, return_type, workspace, hull_indices);
+    return hull_indices;
+}
+
+/// @brief Construct Convex Hull using Melkman's algorithm in O(n) time. Points must be given in the order of a simple
+/// polyline or polygon, whose segments do not cross each other; the hull of any other input is undefined.
+template <typename T, typename Points>
+void constructMelkmanConvexHull(const Points &points, Orientation orientation, ConvexHullReturnType return_type,
+                                ConvexHullWorkspace<T> &workspace, std::vector<int> &hull_indices)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, ConvexHullAlgorithm::MELKMAN, points.size());
+    hull_indices.clear();
+    int n = static_cast<int>(points.size());
+    if (n < 3)
+    {
+        // Convex Hull is not possible for less than 3 points
+        return;
+    }
+
+    // Skip the leading points that lie on one line, keeping the two extremes of the segment they span
+    CONVEX_HULL_STAGE(SCAN);
+    int low = 0;
+    int high = 1;
+    while (high < n && points[high] == points[low])
+    {
+        ++high;
+    }
+    if (high == n)
+    {
+        hull_indices.push_back(low);
+        applyOrientationAndReturnType(hull_indices, orientation, return_type);
+        return;
+    }
+    if (points[high] < points[low])
+    {
+        std::swap(low, high);
+    }
+
+    int i = std::max(low, high) + 1;
+    for (; i < n && getOrientationSign(points[low], points[high], points[i]) == 0; ++i)
+    {
+        if (points[i] < points[low])
+        {
+            low = i;
+        }
+        else if (points[high] < points[i])
+        {
+            high = i;
+        }
+    }
+    if (i == n)
+    {
+        hull_indices.push_back(low);
+        hull_indices.push_back(high);
+        applyOrientationAndReturnType(hull_indices, orientation, return_type);
+        return;
+    }
+
+    // The deque holds the counterclockwise hull of the polyline processed so far, with its last vertex stored at both
+    // ends; each point adds at most one slot at either end, so the buffer never overflows
+    auto &deque = workspace.indices;
+    deque.resize(2 * n + 1);
+    int bottom = n;
+    int top = n + 3;
+    deque[bottom] = deque[top] = i;
+    if (getOrientationSign(points[low], points[high], points[i]) > 0)
+    {
+        deque[bottom + 1] = low;
+        deque[bottom + 2] = high;
+    }
+    else
+    {
+        deque[bottom + 1] = high;
+        deque[bottom + 2] = low;
+    }
+
+    for (++i; i < n; ++i)
+    {
+        // The polyline leaves the hull only through the wedge at its last vertex, so points on the inner side of both
+        // edges incident to that vertex are inside the hull
+        const auto &point = points[i];
+        if (getOrientationSign(points[deque[top - 1]], points[deque[top]], point) >= 0 &&
+            getOrientationSign(points[deque[bottom]], points[deque[bottom + 1]], point) >= 0)
+        {
+            continue;
+        }
+
+        // Remove vertices that are no longer strictly convex on both sides, then store the point at both ends
+        while (top - bottom > 1 && getOrientationSign(points[deque[top - 1]], points[deque[top]], point) <= 0)
+        {
+            --top;
+            CONVEX_HULL_COUNT(number_of_hull_pops, 1);
+        }
+        deque[++top] = i;
+        while (top - bottom > 1 && getOrientationSign(points[deque[bottom]], points[deque[bottom + 1]], point) <= 0)
+        {
+            ++bottom;
+            CONVEX_HULL_COUNT(number_of_hull_pops, 1);
+        }
+        deque[--bottom] = i;
+    }
+
+    // Start the hull at its lowest vertex, as the sorting algorithms do
+    hull_indices.assign(deque.begin() + bottom, deque.begin() + top);
+    std::rotate(hull_indices.begin(),
+                std::min_element(hull_indices.begin(), hull_indices.end(),
+                                 [&](int i1, int i2) noexcept -> bool { return points[i1] < points[i2]; }),
+                hull_indices.end());
+
+    applyOrientationAndReturnType(hull_indices, orientation, return_type);
+}
+
+/// @brief Construct Convex Hull using Melkman's algorithm in O(n) time. Points must be given in the order of a simple
+/// polyline or polygon, whose segments do not cross each other; the hull of any other input is undefined.
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructMelkmanConvexHull(const Points &points, Orientation orientation,
+                                            ConvexHullReturnType return_type)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructMelkmanConvexHull(points, orientation, return_type, workspace, hull_indices);
+    return hull_indices;
+}
+
+/// @brief Construct Convex Hull using Jarvis March algorithm
+template <typename T, typename Points>
+void constructJarvisMarchConvexHull(const Points &points, Orientation orientation, ConvexHullReturnType return_type,
+                                    ConvexHullWorkspace<T> &workspace, std::vector<int> &hull_indices)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, ConvexHullAlgorithm::JARVIS_MARCH, points.size());
+    hull_indices.clear();
+    int n = static_cast<int>(points.size());
+    if (n < 3)
+    {
+        // Convex Hull is not possible for less than 3 points
+        return;
+    }
+
+    // Find the leftmost point (with the lowest y-coordinate if there is a tie), which is a hull vertex
+    CONVEX_HULL_STAGE(SCAN);
+    int leftmost = 0;
+    for (int i = 1; i < n; ++i)
+    {
+        if (points[i].x < points[leftmost].x ||
+            (points[i].x == points[leftmost].x && points[i].y < points[leftmost].y))
+        {
+            leftmost = i;
+        }
+    }
+
+    // Start from leftmost point, keep moving counterclockwise
+    // until reaching the start point again.
+    int p = leftmost;
+
+    do
+    {
+        // Add current point to result
+        hull_indices.push_back(p);
+
+        // Iterate over all points to find the point with the smallest polar angle with respect to the current
+        // point (p), skipping duplicates of p and taking the farthest of collinear points
+        int q = -1;
+        for (int i = 0; i < n; ++i)
+        {
+            if (points[i] == points[p])
+            {
+                continue;
+            }
+
+            // If i is more clockwise than current q, then all points lie to the left of (p, i)
+            if (q < 0 || isMoreClockwise(points[p], points[q], squaredDistance(points[p], points[q]), points[i],
+                                         squaredDistance(points[p], points[i])))
+            {
+                q = i;
+            }
+        }
+
+        // Set p to be q for the next iteration
+        p = q;
+
+    } while (p >= 0 && p != leftmost &&
+             static_cast<int>(hull_indices.size()) < n); // Continue until we reach the starting point again
+
+    applyOrientationAndReturnType(hull_indices, orientation, return_type);
+}
+
+/// @brief Construct Convex Hull using Jarvis March algorithm
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructJarvisMarchConvexHull(const Points &points, Orientation orientation,
+                                                ConvexHullReturnType return_type)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructJarvisMarchConvexHull(points, orientation, return_type, workspace, hull_indices);
+    return hull_indices;
+}
+
+/// @brief Construct Convex Hull using Jarvis March algorithm over structure-of-arrays points, where the search for
+/// the next hull vertex runs on batched SIMD kernels
+template <typename T>
+void constructJarvisMarchConvexHull(const PointArray<T> &points, Orientation orientation,
+                                    ConvexHullReturnType return_type, ConvexHullWorkspace<T> &workspace,
+                                    std::vector<int> &hull_indices)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, ConvexHullAlgorithm::JARVIS_MARCH, points.size());
+    hull_indices.clear();
+    int n = static_cast<int>(points.size());
+    if (n < 3)
+    {
+        // Convex Hull is not possible for less than 3 points
+        return;
+    }
+
+    const T *x = points.x.data();
+    const T *y = points.y.data();
+
+    // Find the leftmost point (with the lowest y-coordinate if there is a tie), which is a hull vertex
+    CONVEX_HULL_STAGE(SCAN);
+    int leftmost = 0;
+    for (int i = 1; i < n; ++i)
+    {
+        if (x[i] < x[leftmost] || (x[i] == x[leftmost] && y[i] < y[leftmost]))
+        {
+            leftmost = i;
+        }
+    }
+
+    // Start from leftmost point, keep moving counterclockwise until reaching the start point again
+    int p = leftmost;
+    do
+    {
+        hull_indices.push_back(p);
+        p = findMostClockwisePoint(x, y, n, p);
+    } while (p >= 0 && p != leftmost && static_cast<int>(hull_indices.size()) < n);
+
+    applyOrientationAndReturnType(hull_indices, orientation, return_type);
+}
+
+/// @brief Construct Convex Hull using Jarvis March algorithm over structure-of-arrays points, where the search for
+/// the next hull vertex runs on batched SIMD kernels
+template <typename T>
+std::vector<int> constructJarvisMarchConvexHull(const PointArray<T> &points, Orientation orientation,
+                                                ConvexHullReturnType return_type)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructJarvisMarchConvexHull(points, orientation, return_type, workspace, hull_indices);
+    return hull_indices;
+}
+
+/// @brief Returns the position within a counterclockwise convex polygon of the vertex that is tangent from point p,
+/// i.e. the vertex q such that no polygon vertex lies to the right of the ray from p through q (the farthest one if
+/// several are collinear with p). Runs in O(log h) for a point outside the polygon. Vertex i is read as
+/// get_vertex(i).
+template <typename T, typename VertexAccessor>
+int findConvexPolygonTangent(VertexAccessor &&get_vertex, int h, const Point<T> &p) noexcept
+{
+    const auto vertex = [&](int i) noexcept -> decltype(auto) { return get_vertex(i % h); };
+    const auto is_same = [](const Point<T> &p1, const Point<T> &p2) noexcept { return p1.x == p2.x && p1.y == p2.y; };
+
+    int q = 0;
+    if (h > 8)
+    {
+        // Binary search over the polygon chain [a, b] (with V[h] = V[0]) for the vertex whose neighbours
+        // both lie to the left of the ray from p
+        const auto above = [&](int i, int j) noexcept { return getOrientationSign(p, vertex(i), vertex(j)) > 0; };
+        const auto below = [&](int i, int j) noexcept { return getOrientationSign(p, vertex(i), vertex(j)) < 0; };
+
+        int a = 0;
+        int b = h;
+        while (b - a > 1)
+        {
+            const int c = (a + b) / 2;
+            const bool down_c = below(c + 1, c);
+            if (down_c && !above(c - 1, c))
+            {
+                a = c;
+                break;
+            }
+
+            // Select the subchain [a, c] or [c, b] that contains the tangent
+            if (above(a + 1, a))
+            {
+                if (down_c || above(a, c))
+                {
+                    b = c;
+                }
+                else
+                {
+                    a = c;
+                }
+            }
+            else
+            {
+                if (!down_c || !below(a, c))
+                {
+                    a = c;
+                }
+                else
+                {
+                    b = c;
+                }
+            }
+        }
+        q = a % h;
+    }
+
+    // Walk to the exact tangent, which resolves the small polygons and collinear or coincident configurations
+    // the binary search is unable to distinguish
+    for (int step = 0; step < 2 * h; ++step)
+    {
+        const int next = (q + 1) % h;
+        const int prev = (q + h - 1) % h;
+        const int orientation_next = getOrientationSign(p, vertex(q), vertex(next));
+        if (is_same(vertex(q), p) || orientation_next < 0 ||
+            (orientation_next == 0 && squaredDistance(p, vertex(next)) > squaredDistance(p, vertex(q))))
+        {
+            q = next;
+        }
+        else if (getOrientationSign(p, vertex(q), vertex(prev)) < 0)
+        {
+            q = prev;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return q;
+}
+
+/// @brief Returns the position within a counterclockwise convex polygon, whose vertex i is points[hull[i]], of the
+/// vertex that is tangent from point p, as above
+template <typename T, typename Points>
+int findConvexPolygonTangent(const Points &points, const int *hull, int h, const Point<T> &p) noexcept
+{
+    return findConvexPolygonTangent([&](int i) noexcept -> decltype(auto) { return points[hull[i]]; }, h, p);
+}
+
+/// @brief Construct Convex Hull using Chan's algorithm, based on Andrew's Monotone Chain and Jarvis March
+template <typename T, typename Points>
+void constructChanConvexHull(const Points &points, Orientation orientation, ConvexHullReturnType return_type,
+                             ConvexHullWorkspace<T> &workspace, std::vector<int> &hull_indices)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, ConvexHullAlgorithm::CHAN, points.size());
+    hull_indices.clear();
+    int n = static_cast<int>(points.size());
+    if (n < 3)
+    {
+        // Convex Hull is not possible for less than 3 points
+        return;
+    }
+
+    const auto is_same = [](const Point<T> &p1, const Point<T> &p2) noexcept { return p1.x == p2.x && p1.y == p2.y; };
+
+    // Find point with the lowest y-coordinate (and lowest x coordinate if there is a tie), which is a hull vertex
+    int start = 0;
+    for (int i = 1; i < n; ++i)
+    {
+        if (points[i].y < points[start].y || (points[i].y == points[start].y && points[i].x < points[start].x))
+        {
+            start = i;
+        }
+    }
+
+    auto &indices = workspace.indices;
+    auto &subset_hulls = workspace.subset_hulls;
+    auto &subset_offsets = workspace.subset_offsets;
+    indices.resize(n);
+    subset_hulls.reserve(2 * n);
+    workspace.radix_items.resize(2 * n);
+
+    // Guess hull size m = 2^(2^t), until the wrapping closes within m steps. Guesses start at m = 256, since every
+    // failed guess costs a full pass of tangent queries, which for smaller m is slower than the group hulls it saves.
+    for (int t = 3;; ++t)
+    {
+        const int exponent = std::min(1 << t, 30);
+        const int m = static_cast<int>(std::min<long long>(1LL << exponent, n));
+        const int number_of_subsets = (n + m - 1) / m;
+
+        // Compute counterclockwise convex hull of each contiguous subset of m points
+        std::iota(indices.begin(), indices.end(), 0);
+        subset_hulls.clear();
+        subset_offsets.assign(1, 0);
+        for (int subset_no = 0; subset_no < number_of_subsets; ++subset_no)
+        {
+            const int first = subset_no * m;
+            const int last = std::min(first + m, n);
+            appendMonotoneChainConvexHull(points, indices.data() + first, indices.data() + last, subset_hulls,
+                                          workspace.radix_items.data() + 2 * first);
+            subset_offsets.push_back(static_cast<int>(subset_hulls.size()));
+        }
+
+        // Locate the start point within the hull of its subset
+        int current_subset = start / m;
+        int current_position = -1;
+        for (int i = subset_offsets[current_subset]; i < subset_offsets[current_subset + 1]; ++i)
+        {
+            if (is_same(points[subset_hulls[i]], points[start]))
+            {
+                current_position = i - subset_offsets[current_subset];
+                break;
+            }
+        }
+        if (current_position < 0)
+        {
+            current_subset = -1;
+        }
+
+        // Wrap around the subset hulls, picking the next vertex among the tangents from the current point
+        CONVEX_HULL_STAGE(MERGE);
+        hull_indices.clear();
+        int current = start;
+        bool closed = false;
+        for (int step = 0; step < m; ++step)
+        {
+            hull_indices.push_back(current);
+
+            int best = -1;
+            int best_subset = -1;
+            int best_position = -1;
+            for (int subset_no = 0; subset_no < number_of_subsets; ++subset_no)
+            {
+                const int *subset_hull = subset_hulls.data() + subset_offsets[subset_no];
+                const int h = subset_offsets[subset_no + 1] - subset_offsets[subset_no];
+
+                // Within its own subset the current point is a hull vertex, so its successor is the tangent
+                const int position = (subset_no == current_subset)
+                                         ? (current_position + 1) % h
+                                         : findConvexPolygonTangent(points, subset_hull, h, points[current]);
+                const int candidate = subset_hull[position];
+                if (is_same(points[candidate], points[current]))
+                {
+                    continue;
+                }
+
+                bool is_better = (best < 0);
+                if (!is_better)
+                {
+                    const int orientation = getOrientationSign(points[current], points[best], points[candidate]);
+                    is_better = orientation < 0 ||
+                                (orientation == 0 && squaredDistance(points[current], points[candidate]) >
+                                                         squaredDistance(points[current], points[best]));
+                }
+                if (is_better)
+                {
+                    best = candidate;
+                    best_subset = subset_no;
+                    best_position = position;
+                }
+            }
+
+            if (best < 0 || is_same(points[best], points[start]))
+            {
+                closed = true;
+                break;
+            }
+
+            current = best;
+            current_subset = best_subset;
+            current_position = best_position;
+        }
+
+        if (closed || m == n)
+        {
+            break;
+        }
+    }
+
+    applyOrientationAndReturnType(hull_indices, orientation, return_type);
+}
+
+/// @brief Construct Convex Hull using Chan's algorithm, based on Andrew's Monotone Chain and Jarvis March
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructChanConvexHull(const Points &points, Orientation orientation,
+                                         ConvexHullReturnType return_type)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructChanConvexHull(points, orientation, return_type, workspace, hull_indices);
+    return hull_indices;
+}
+
+/// @brief Returns rounding error bound of the cross products of edge (p1, p2) with points inside a bounding box of the
+/// given width and height, which a cross product has to exceed to prove that a point lies strictly left of the edge
+template <typename T>
+Accumulator<T> getEdgeCrossProductErrorBound(const Point<T> &p1, const Point<T> &p2, Accumulator<T> width,
+                                             Accumulator<T> height) noexcept
+{
+    if constexpr (std::is_floating_point<T>::value && CONVEX_HULL_ROBUST_PREDICATES)
+    {
+        // Twice the orient2d bound, which also covers rounding of the bounding box extents
+        return 2 * getCrossProductErrorBound<T>() *
+               (std::fabs(p2.x - p1.x) * height + std::fabs(p2.y - p1.y) * width);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/// @brief Stores counterclockwise polygon formed by the extreme points used by the given filter, with repeated
+/// vertices dropped. The polygon is left empty if the extreme points do not enclose any area.
+template <typename T, typename PointAccessor>
+void makeExtremePointPolygon(const ExtremePointIndices &extremes, ConvexHullFilter filter, PointAccessor &&point_at,
+                             std::vector<Point<T>> &polygon)
+{
+    const int octagon_indices[] = {extremes.min_y, extremes.max_diff, extremes.max_x, extremes.max_sum,
+                                   extremes.max_y, extremes.min_diff, extremes.min_x, extremes.min_sum};
+    const int quadrilateral_indices[] = {extremes.min_y, extremes.max_x, extremes.max_y, extremes.min_x};
+    const bool is_octagon = (filter == ConvexHullFilter::OCTAGON);
+    const int *polygon_indices = is_octagon ? octagon_indices : quadrilateral_indices;
+    const int number_of_vertices = is_octagon ? 8 : 4;
+
+    polygon.clear();
+    for (int i = 0; i < number_of_vertices; ++i)
+    {
+        const Point<T> p = point_at(polygon_indices[i]);
+        if (polygon.empty() || p.x != polygon.back().x || p.y != polygon.back().y)
+        {
+            polygon.push_back(p);
+        }
+    }
+    while (polygon.size() > 1 && polygon.front().x == polygon.back().x && polygon.front().y == polygon.back().y)
+    {
+        polygon.pop_back();
+    }
+    if (polygon.size() < 3)
+    {
+        polygon.clear();
+    }
+}
+
+/// @brief Moves indices in [first, last) of points that are not strictly inside the Akl-Toussaint polygon to the front
+/// of the range, preserving their order, and returns the end of the surviving indices
+template <typename T, typename Points>
+int *filterInteriorPoints(const Points &points, int *first, int *last, ConvexHullFilter filter,
+                          std::vector<Point<T>> &polygon)
+{
+    if (last - first < 3 || filter == ConvexHullFilter::NONE)
+    {
+        return last;
+    }
+
+    // Extreme values are kept next to their indices, so that the scan does not reload the current extreme points
+    using A = Accumulator<T>;
+    const int i0 = *first;
+    ExtremePointIndices extremes{i0, i0, i0, i0, i0, i0, i0, i0};
+    T min_x = points[i0].x, max_x = min_x, min_y = points[i0].y, max_y = min_y;
+    A min_sum = A(min_x) + A(min_y), max_sum = min_sum, min_diff = A(min_x) - A(min_y), max_diff = min_diff;
+    for (const int *it = first + 1; it != last; ++it)
+    {
+        const int i = *it;
+        const T x = points[i].x;
+        const T y = points[i].y;
+        const A sum = A(x) + A(y);
+        const A difference = A(x) - A(y);
+        if (x < min_x)
+        {
+            min_x = x;
+            extremes.min_x = i;
+        }
+        if (x > max_x)
+        {
+            max_x = x;
+            extremes.max_x = i;
+        }
+        if (y < min_y)
+        {
+            min_y = y;
+            extremes.min_y = i;
+        }
+        if (y > max_y)
+        {
+            max_y = y;
+            extremes.max_y = i;
+        }
+        if (sum < min_sum)
+        {
+            min_sum = sum;
+            extremes.min_sum = i;
+        }
+        if (sum > max_sum)
+        {
+            max_sum = sum;
+            extremes.max_sum = i;
+        }
+        if (difference < min_diff)
+        {
+            min_diff = difference;
+            extremes.min_diff = i;
+        }
+        if (difference > max_diff)
+        {
+            max_diff = difference;
+            extremes.max_diff = i;
+        }
+    }
+
+    makeExtremePointPolygon<T>(extremes, filter, [&](int i) { return points[i]; }, polygon);
+    if (polygon.empty())
+    {
+        return last;
+    }
+
+    const int m = static_cast<int>(polygon.size());
+    const A width = A(points[extremes.max_x].x) - A(points[extremes.min_x].x);
+    const A height = A(points[extremes.max_y].y) - A(points[extremes.min_y].y);
+    A edge_dx[8], edge_dy[8], edge_bound[8];
+    for (int j = 0; j < m; ++j)
+    {
+        edge_dx[j] = A(polygon[(j + 1) % m].x) - A(polygon[j].x);
+        edge_dy[j] = A(polygon[(j + 1) % m].y) - A(polygon[j].y);
+        edge_bound[j] = getEdgeCrossProductErrorBound(polygon[j], polygon[(j + 1) % m], width, height);
+    }
+
+    int *end = first;
+    for (const int *it = first; it != last; ++it)
+    {
+        const auto &p = points[*it];
+        bool is_inside = true;
+        for (int j = 0; j < m; ++j)
+        {
+            is_inside &=
+                (edge_dx[j] * (A(p.y) - A(polygon[j].y)) - (A(p.x) - A(polygon[j].x)) * edge_dy[j] > edge_bound[j]);
+        }
+        *end = *it;
+        end += !is_inside;
+    }
+    return end;
+}
+
+/// @brief Returns indices of points that are not strictly inside the polygon formed by the extreme points in 4
+/// (QUADRILATERAL) or 8 (OCTAGON) directions, following Akl-Toussaint heuristic. Hull vertices always survive.
+template <typename T, typename Points>
+void filterInteriorPoints(const Points &points, ConvexHullFilter filter, ConvexHullWorkspace<T> &workspace,
+                          std::vector<int> &survivor_indices)
+{
+    survivor_indices.resize(points.size());
+    std::iota(survivor_indices.begin(), survivor_indices.end(), 0);
+    int *const first = survivor_indices.data();
+    int *const end = filterInteriorPoints(points, first, first + survivor_indices.size(), filter, workspace.polygon);
+    survivor_indices.resize(end - first);
+}
+
+/// @brief Returns indices of points that are not strictly inside the polygon formed by the extreme points in 4
+/// (QUADRILATERAL) or 8 (OCTAGON) directions, following Akl-Toussaint heuristic. Hull vertices always survive.
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> filterInteriorPoints(const Points &points, ConvexHullFilter filter)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> survivor_indices;
+    filterInteriorPoints(points, filter, workspace, survivor_indices);
+    return survivor_indices;
+}
+
+/// @brief Returns indices of structure-of-arrays points that are not strictly inside the Akl-Toussaint polygon,
+/// evaluated blockwise with the batched SIMD kernels
+template <typename T>
+void filterInteriorPoints(const PointArray<T> &points, ConvexHullFilter filter, ConvexHullWorkspace<T> &workspace,
+                          std::vector<int> &survivor_indices)
+{
+    int n = static_cast<int>(points.size());
+    survivor_indices.resize(n);
+    std::iota(survivor_indices.begin(), survivor_indices.end(), 0);
+    if (n < 3 || filter == ConvexHullFilter::NONE)
+    {
+        return;
+    }
+
+    const T *x = points.x.data();
+    const T *y = points.y.data();
+    const auto extremes = findExtremePoints(x, y, n);
+    auto &polygon = workspace.polygon;
+    makeExtremePointPolygon<T>(extremes, filter, [&](int i) { return points[i]; }, polygon);
+    if (polygon.empty())
+    {
+        return;
+    }
+
+    // Test blocks of points against every polygon edge, so that cross products stay in cache
+    constexpr int block_size = 256;
+    using A = Accumulator<T>;
+    A cross_products[block_size];
+    bool is_inside[block_size];
+
+    const int m = static_cast<int>(polygon.size());
+    const A width = A(x[extremes.max_x]) - A(x[extremes.min_x]);
+    const A height = A(y[extremes.max_y]) - A(y[extremes.min_y]);
+    A edge_bound[8];
+    for (int j = 0; j < m; ++j)
+    {
+        edge_bound[j] = getEdgeCrossProductErrorBound(polygon[j], polygon[(j + 1) % m], width, height);
+    }
+
+    int count = 0;
+    for (int first = 0; first < n; first += block_size)
+    {
+        const int size = std::min(block_size, n - first);
+        std::fill(is_inside, is_inside + size, true);
+        for (int j = 0; j < m; ++j)
+        {
+            computeCrossProducts(x + first, y + first, size, polygon[j], polygon[(j + 1) % m], cross_products);
+            for (int k = 0; k < size; ++k)
+            {
+                is_inside[k] &= (cross_products[k] > edge_bound[j]);
+            }
+        }
+        for (int k = 0; k < size; ++k)
+        {
+            survivor_indices[count] = first + k;
+            count += !is_inside[k];
+        }
+    }
+    survivor_indices.resize(count);
+}
+
+/// @brief Returns indices of structure-of-arrays points that are not strictly inside the Akl-Toussaint polygon,
+/// evaluated blockwise with the batched SIMD kernels
+template <typename T> std::vector<int> filterInteriorPoints(const PointArray<T> &points, ConvexHullFilter filter)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> survivor_indices;
+    filterInteriorPoints(points, filter, workspace, survivor_indices);
+    return survivor_indices;
+}
+
+/// @brief Returns number of worker threads to use, where 0 requests one thread per hardware thread
+inline int getNumberOfThreads(int number_of_threads) noexcept
+{
+    if (number_of_threads <= 0)
+    {
+        number_of_threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    return std::max(number_of_threads, 1);
+}
+
+/// @brief Persistent pool of worker threads that runs sets of numbered tasks with work stealing. Workers are started
+/// on first use and kept for later task sets, so that repeated parallel constructions do not start threads. Every
+/// participant of a task set owns the task numbers congruent to its participant number and starts them in increasing
+/// order, then steals pending tasks of the other participants. A task may therefore wait for any task of smaller
+/// number, which is already running or next in line for its owner.
+class ConvexHullThreadPool
+{
+  public:
+    ConvexHullThreadPool() = default;
+
+    ConvexHullThreadPool(const ConvexHullThreadPool &) = delete;
+    ConvexHullThreadPool &operator=(const ConvexHullThreadPool &) = delete;
+
+    ~ConvexHullThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            is_stopping_ = true;
+        }
+        start_condition_.notify_all();
+        for (auto &worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    /// @brief Runs task(task_no, participant_no) for every task_no in [0, number_of_tasks) on the calling thread,
+    /// which is participant 0, and up to number_of_threads - 1 workers. Task sets of different threads run one after
+    /// the other, and a task set started by a task of this pool runs serially on the calling thread.
+    template <typename Task> void run(int number_of_tasks, int number_of_threads, const Task &task)
+    {
+        number_of_threads = std::min(getNumberOfThreads(number_of_threads), number_of_tasks);
+        if (number_of_threads <= 1 || getRunningPool() == this)
+        {
+            for (int task_no = 0; task_no < number_of_tasks; ++task_no)
+            {
+                task(task_no, 0);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+        startWorkers(number_of_threads - 1);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            run_task_ = [](const void *task, int task_no, int participant_no) {
+                (*static_cast<const Task *>(task))(task_no, participant_no);
+            };
+            number_of_tasks_ = number_of_tasks;
+            number_of_participants_ = number_of_threads;
+            number_of_busy_workers_ = number_of_threads - 1;
+            for (int participant_no = 0; participant_no < number_of_threads; ++participant_no)
+            {
+                queues_[participant_no].next_task.store(participant_no, std::memory_order_relaxed);
+            }
+            ++task_set_no_;
+        }
+        start_condition_.notify_all();
+
+        work(0);
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_condition_.wait(lock, [&]() { return number_of_busy_workers_ == 0; });
+    }
+
+  private:
+    /// @brief Next task number of a participant, padded to a cache line so that participants do not share lines
+    struct alignas(64) TaskQueue
+    {
+        std::atomic<int> next_task{0};
+    };
+
+    static ConvexHullThreadPool *&getRunningPool() noexcept
+    {
+        static thread_local ConvexHullThreadPool *running_pool = nullptr;
+        return running_pool;
+    }
+
+    /// @brief Starts workers up to the given number, called between task sets only
+    void startWorkers(int number_of_workers)
+    {
+        if (number_of_workers <= static_cast<int>(workers_.size()))
+        {
+            return;
+        }
+        queues_.reset(new TaskQueue[number_of_workers + 1]);
+        workers_.reserve(number_of_workers);
+        for (int worker_no = static_cast<int>(workers_.size()); worker_no < number_of_workers; ++worker_no)
+        {
+            workers_.emplace_back(
+                [this, worker_no, task_set_no = task_set_no_]() { runWorker(worker_no, task_set_no); });
+        }
+    }
+
+    /// @brief Waits for task sets that include the worker and runs their tasks as participant worker_no + 1
+    void runWorker(int worker_no, long long task_set_no)
+    {
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_condition_.wait(lock, [&]() { return is_stopping_ || task_set_no_ != task_set_no; });
+                if (is_stopping_)
+                {
+                    return;
+                }
+                task_set_no = task_set_no_;
+                if (worker_no + 1 >= number_of_participants_)
+                {
+                    continue;
+                }
+            }
+
+            work(worker_no + 1);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --number_of_busy_workers_;
+            }
+            done_condition_.notify_one();
+        }
+    }
+
+    /// @brief Runs the own tasks of participant_no, then steals pending tasks of the other participants
+    void work(int participant_no)
+    {
+        auto &running_pool = getRunningPool();
+        auto *const previous_pool = running_pool;
+        running_pool = this;
+        for (int offset = 0; offset < number_of_participants_; ++offset)
+        {
+            auto &next_task = queues_[(participant_no + offset) % number_of_participants_].next_task;
+            for (int task_no = next_task.fetch_add(number_of_participants_); task_no < number_of_tasks_;
+                 task_no = next_task.fetch_add(number_of_participants_))
+            {
+                run_task_(task_, task_no, participant_no);
+            }
+        }
+        running_pool = previous_pool;
+    }
+
+    std::vector<std::thread> workers_;
+    std::unique_ptr<TaskQueue[]> queues_;
+    std::mutex run_mutex_; // Held while a task set runs
+    std::mutex mutex_;     // Guards the task set and worker states below
+    std::condition_variable start_condition_;
+    std::condition_variable done_condition_;
+    long long task_set_no_ = 0;
+    bool is_stopping_ = false;
+    int number_of_busy_workers_ = 0;
+
+    // Current task set
+    const void *task_ = nullptr;
+    void (*run_task_)(const void *, int, int) = nullptr;
+    int number_of_tasks_ = 0;
+    int number_of_participants_ = 0;
+};
+
+/// @brief Returns the pool shared by parallel algorithms that are not given one
+inline ConvexHullThreadPool &getDefaultConvexHullThreadPool()
+{
+    static ConvexHullThreadPool thread_pool;
+    return thread_pool;
+}
+
+/// @brief Returns the pool of the workspace, or the default pool if the workspace has none
+template <typename T> ConvexHullThreadPool &getConvexHullThreadPool(const ConvexHullWorkspace<T> &workspace)
+{
+    return workspace.thread_pool != nullptr ? *workspace.thread_pool : getDefaultConvexHullThreadPool();
+}
+
+/// @brief Runs task(task_no) for every task_no in [0, number_of_tasks) on up to number_of_threads threads of
+/// thread_pool, the calling thread included, where idle threads steal pending tasks so that uneven tasks stay balanced
+template <typename Task>
+void runParallelTasks(ConvexHullThreadPool &thread_pool, int number_of_tasks, int number_of_threads, Task &&task)
+{
+    // Workers count into stats of their own, while the calling thread participates with the stats of its construction
+    ConvexHullWorkerStats worker_stats(getNumberOfThreads(number_of_threads) - 1);
+    thread_pool.run(number_of_tasks, number_of_threads, [&](int task_no, int participant_no) {
+        if (participant_no == 0)
+        {
+            task(task_no);
+        }
+        else
+        {
+            worker_stats.run(participant_no - 1, [&]() { task(task_no); });
+        }
+    });
+}
+
+/// @brief Runs task(task_no) for every task_no in [0, number_of_tasks) on up to number_of_threads threads of the
+/// default pool
+template <typename Task> void runParallelTasks(int number_of_tasks, int number_of_threads, Task &&task)
+{
+    runParallelTasks(getDefaultConvexHullThreadPool(), number_of_tasks, number_of_threads, task);
+}
+
+/// @brief Completion flags that let tasks of runParallelTasks wait for the tasks of smaller number they depend on
+class ConvexHullTaskDependencies
+{
+  public:
+    ConvexHullTaskDependencies(std::vector<char> &is_done, int number_of_tasks) : is_done_(is_done)
+    {
+        is_done_.assign(number_of_tasks, 0);
+    }
+
+    ConvexHullTaskDependencies(const ConvexHullTaskDependencies &) = delete;
+    ConvexHullTaskDependencies &operator=(const ConvexHullTaskDependencies &) = delete;
+
+    void setDone(int task_no)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            is_done_[task_no] = 1;
+        }
+        condition_.notify_all();
+    }
+
+    void waitUntilDone(int task_no)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [&]() { return is_done_[task_no] != 0; });
+    }
+
+  private:
+    std::vector<char> &is_done_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+};
+
+/// @brief Construct Convex Hull using Andrew's Monotone Chain on multiple threads. Chunk hulls are computed in
+/// parallel and merged pairwise in a parallel reduction, producing the same hull as the serial algorithm.
+template <typename T, typename Points>
+void constructParallelAndrewMonotoneChainConvexHull(const Points &points, Orientation orientation,
+                                                    ConvexHullReturnType return_type, ConvexHullWorkspace<T> &workspace,
+                                                    std::vector<int> &hull_indices, int number_of_threads = 0)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, ConvexHullAlgorithm::PARALLEL_ANDREW_MONOTONE_CHAIN,
+                            points.size());
+
+    // Smallest number of points per chunk that is worth processing on a separate thread
+    constexpr int min_chunk_size = 1 << 15;
+
+    int n = static_cast<int>(points.size());
+    number_of_threads = getNumberOfThreads(number_of_threads);
+    if (n < 2 * min_chunk_size || number_of_threads == 1)
+    {
+        constructAndrewMonotoneChainConvexHull(points, orientation, return_type, workspace, hull_indices);
+        return;
+    }
+
+    // Split points into contiguous chunks, several per thread to balance uneven chunk costs. Each chunk radix sorts
+    // in the region of the shared buffer starting at twice the offset of its first point, which is large enough and
+    // disjoint from the regions of concurrent tasks.
+    const int number_of_chunks = std::min(4 * number_of_threads, n / min_chunk_size);
+    const auto getChunkOffset = [&](int chunk_no) noexcept {
+        return static_cast<int>(static_cast<long long>(n) * chunk_no / number_of_chunks);
+    };
+    auto &indices = workspace.indices;
+    indices.resize(n);
+    std::iota(indices.begin(), indices.end(), 0);
+    workspace.radix_items.resize(2 * n);
+
+    // Hulls of pairs of chunks are merged in a parallel reduction, as the hull of the union of point sets is the hull
+    // of the union of their hulls. The merges of each stride follow the chunk tasks, where merge_no of stride merges
+    // chunk 2 * stride * merge_no with the chunk stride apart, and does nothing if that lies past the last chunk.
+    const auto getMergeTaskNo = [&](int stride, int merge_no) noexcept {
+        int task_no = number_of_chunks;
+        for (int previous_stride = 1; previous_stride < stride; previous_stride *= 2)
+        {
+            task_no += (number_of_chunks + 2 * previous_stride - 1) / (2 * previous_stride);
+        }
+        return task_no + merge_no;
+    };
+
+    // Returns the task that last stored the hull of chunk_no before the merges of stride
+    const auto getHullTaskNo = [&](int chunk_no, int stride) noexcept {
+        for (int previous_stride = stride / 2; previous_stride >= 1; previous_stride /= 2)
+        {
+            if (chunk_no + previous_stride < number_of_chunks)
+            {
+                return getMergeTaskNo(previous_stride, chunk_no / (2 * previous_stride));
+            }
+        }
+        return chunk_no;
+    };
+
+    int number_of_merge_levels = 0;
+    while ((1 << number_of_merge_levels) < number_of_chunks)
+    {
+        ++number_of_merge_levels;
+    }
+    const int number_of_tasks = getMergeTaskNo(1 << number_of_merge_levels, 0);
+
+    // Chunk hulls and all merges run as one set of tasks, so that every merge starts as soon as both of its hulls are
+    // done, rather than after all merges of the previous stride. Stage time of the set is counted as scan time.
+    CONVEX_HULL_STAGE(SCAN);
+    auto &chunk_hulls = workspace.chunk_hulls;
+    auto &chunk_merges = workspace.chunk_merges;
+    chunk_hulls.resize(std::max<std::size_t>(chunk_hulls.size(), number_of_chunks));
+    chunk_merges.resize(std::max<std::size_t>(chunk_merges.size(), number_of_chunks));
+    ConvexHullTaskDependencies dependencies(workspace.task_done, number_of_tasks);
+    runParallelTasks(getConvexHullThreadPool(workspace), number_of_tasks, number_of_threads, [&](int task_no) {
+        if (task_no < number_of_chunks)
+        {
+            // Compute counterclockwise hull of the chunk
+            const int first = getChunkOffset(task_no);
+            const int last = getChunkOffset(task_no + 1);
+            chunk_hulls[task_no].clear();
+            chunk_hulls[task_no].reserve(2 * (last - first));
+            appendMonotoneChainConvexHull(points, indices.data() + first, indices.data() + last, chunk_hulls[task_no],
+                                          workspace.radix_items.data() + 2 * first);
+            dependencies.setDone(task_no);
+            return;
+        }
+
+        int stride = 1;
+        while (task_no >= getMergeTaskNo(2 * stride, 0))
+        {
+            stride *= 2;
+        }
+        const int left = 2 * stride * (task_no - getMergeTaskNo(stride, 0));
+        const int right = left + stride;
+        if (right < number_of_chunks)
+        {
+            dependencies.waitUntilDone(getHullTaskNo(left, stride));
+            dependencies.waitUntilDone(getHullTaskNo(right, stride));
+
+            // Both hulls are merged into (y, x, index) order in linear time, rather than sorted again
+            auto &buffers = chunk_merges[left];
+            for (const int chunk_no : {left, right})
+            {
+                const auto &chunk_hull = chunk_hulls[chunk_no];
+                appendConvexHullMergeRuns(points, chunk_hull.data(), static_cast<int>(chunk_hull.size()), buffers);
+            }
+
+            chunk_hulls[left].clear();
+            chunk_hulls[left].reserve(2 * buffers.vertices.size());
+            appendMergedConvexHull(buffers, chunk_hulls[left]);
+            chunk_hulls[right].clear();
+        }
+        dependencies.setDone(task_no);
+    });
+
+    hull_indices.assign(chunk_hulls[0].begin(), chunk_hulls[0].end());
+
+    applyOrientationAndReturnType(hull_indices, orientation, return_type);
+}
+
+/// @brief Construct Convex Hull using Andrew's Monotone Chain on multiple threads
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructParallelAndrewMonotoneChainConvexHull(const Points &points, Orientation orientation,
+                                                                ConvexHullReturnType return_type,
+                                                                int number_of_threads = 0)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructParallelAndrewMonotoneChainConvexHull(points, orientation, return_type, workspace, hull_indices,
+                                                   number_of_threads);
+    return hull_indices;
+}
+
+/// @brief Finds the point of [first, last) farthest to the right of the directed edge (p, q), preferring the one
+/// closest to p on ties, and partitions the range in place into points strictly to the right of (p, c) followed by
+/// points strictly to the right of (c, q). Remaining points lie inside triangle (p, c, q) and are discarded.
+template <typename Points, typename T = PointCoordinate<Points>>
+int partitionQuickhullRange(const Points &points, int *first, int *last, int p, int q, int *&middle, int *&end) noexcept
+{
+    using A = Accumulator<T>;
+    const auto &pp = points[p];
+    const auto &pq = points[q];
+    const auto dx = A(pq.x) - A(pp.x);
+    const auto dy = A(pq.y) - A(pp.y);
+
+    int c = *first;
+    for (int *it = first + 1; it != last; ++it)
+    {
+        // Points at equal distance lie on a line parallel to (p, q), where the sign of the projection difference is
+        // exact, since both of its terms share the same sign
+        const auto &point = points[*it];
+        const auto &pc = points[c];
+        const int comparison = compareCrossProducts(pp, pq, pc, point);
+        if (comparison > 0 || (comparison == 0 && (A(point.x) - A(pc.x)) * dx + (A(point.y) - A(pc.y)) * dy < 0))
+        {
+            c = *it;
+        }
+    }
+
+    const auto &pc = points[c];
+    middle = std::partition(first, last, [&](int i) noexcept { return getOrientationSign(pp, pc, points[i]) < 0; });
+    end = std::partition(middle, last, [&](int i) noexcept { return getOrientationSign(pc, pq, points[i]) < 0; });
+    return c;
+}
+
+/// @brief Appends hull vertices strictly between p and q to hull_indices in counterclockwise order, given points
+/// [first, last) of the index buffer that lie strictly to the right of the directed edge (p, q). Subproblems are
+/// kept on an explicit stack, so that degenerate inputs cannot overflow the call stack.
+template <typename Points>
+void appendQuickhullChain(const Points &points, int *indices, int first, int last, int p, int q,
+                          std::vector<QuickhullFrame> &frames, std::vector<int> &hull_indices)
+{
+    frames.clear();
+    frames.push_back({first, last, p, q});
+    while (!frames.empty())
+    {
+        const auto frame = frames.back();
+        frames.pop_back();
+        if (frame.first < 0)
+        {
+            hull_indices.push_back(frame.p);
+            continue;
+        }
+        if (frame.first == frame.last)
+        {
+            continue;
+        }
+
+        int *middle = nullptr;
+        int *end = nullptr;
+        const int c = partitionQuickhullRange(points, indices + frame.first, indices + frame.last, frame.p, frame.q,
+                                              middle, end);
+        const int middle_offset = static_cast<int>(middle - indices);
+        const int end_offset = static_cast<int>(end - indices);
+
+        // Push in reverse, so that the chain (p, c) is emitted before c and the chain (c, q)
+        frames.push_back({middle_offset, end_offset, c, frame.q});
+        frames.push_back({-1, -1, c, c});
+        frames.push_back({frame.first, middle_offset, frame.p, c});
+    }
+}
+
+/// @brief Updates a and b to the lexicographically smallest and largest of themselves and point i, keeping the first
+/// of coinciding points
+template <typename Points> void updateQuickhullExtremePoints(const Points &points, int i, int &a, int &b) noexcept
+{
+    const auto &point = points[i];
+    if (point.x < points[a].x || (point.x == points[a].x && point.y < points[a].y))
+    {
+        a = i;
+    }
+    if (point.x > points[b].x || (point.x == points[b].x && point.y > points[b].y))
+    {
+        b = i;
+    }
+}
+
+/// @brief Returns -1 if point i lies strictly to the right of the directed edge (a, b), 1 if it lies strictly to the
+/// right of (b, a) and 0 otherwise
+template <typename Points> int getQuickhullSide(const Points &points, int a, int b, int i) noexcept
+{
+    if (getOrientationSign(points[a], points[b], points[i]) < 0)
+    {
+        return -1;
+    }
+    return (getOrientationSign(points[b], points[a], points[i]) < 0) ? 1 : 0;
+}
+
+/// @brief Appends the hulls of the subproblems of node and its descendants in the order of the chain
+inline void appendQuickhullTreeHull(const std::vector<std::vector<int>> &node_hulls, int node, int number_of_nodes,
+                                    std::vector<int> &hull_indices)
+{
+    if (node >= number_of_nodes)
+    {
+        return;
+    }
+    appendQuickhullTreeHull(node_hulls, 2 * node + 1, number_of_nodes, hull_indices);
+    hull_indices.insert(hull_indices.end(), node_hulls[node].begin(), node_hulls[node].end());
+    appendQuickhullTreeHull(node_hulls, 2 * node + 2, number_of_nodes, hull_indices);
+}
+
+/// @brief Appends the counterclockwise hull of Quickhull computed on multiple threads, within a single call of
+/// runParallelTasks whose tasks wait for the tasks they depend on. Chunks of points find their extreme points a and
+/// b, count their points below and above (a, b) and scatter them into the index buffer like the serial algorithm.
+/// Subproblems then form a binary tree with at least 4 leaves per thread, where node 0 splits the points at (a, b),
+/// node i splits its range into those of nodes 2 * i + 1 and 2 * i + 2, and small or leaf ranges are solved
+/// serially. Every range is partitioned as by the serial algorithm, which gives the same hull.
+template <typename T, typename Points>
+void appendParallelQuickhullConvexHull(const Points &points, ConvexHullWorkspace<T> &workspace,
+                                       std::vector<int> &hull_indices, int number_of_threads)
+{
+    const int n = static_cast<int>(points.size());
+    const int number_of_chunks = std::min(4 * number_of_threads, n / min_parallel_quickhull_size);
+    const auto getChunkOffset = [&](int chunk_no) noexcept {
+        return static_cast<int>(static_cast<long long>(n) * chunk_no / number_of_chunks);
+    };
+    int number_of_leaves = 2;
+    while (number_of_leaves < 4 * number_of_threads)
+    {
+        number_of_leaves *= 2;
+    }
+    const int number_of_nodes = 2 * number_of_leaves - 1;
+
+    auto &chunks = workspace.quickhull_chunks;
+    auto &indices = workspace.indices;
+    auto &node_frames = workspace.frames;
+    auto &node_hulls = workspace.chunk_hulls;
+    auto &task_frames = workspace.task_frames;
+    chunks.resize(number_of_chunks);
+    indices.resize(n);
+    node_frames.resize(number_of_nodes);
+    node_hulls.resize(std::max<std::size_t>(node_hulls.size(), number_of_nodes));
+    task_frames.resize(std::max<std::size_t>(task_frames.size(), number_of_nodes));
+
+    // Extreme points of all points, reduced in chunk order so that the first of coinciding points is kept
+    const auto getExtremePoints = [&](int &a, int &b) noexcept {
+        a = chunks[0].a;
+        b = chunks[0].b;
+        for (int chunk_no = 1; chunk_no < number_of_chunks; ++chunk_no)
+        {
+            updateQuickhullExtremePoints(points, chunks[chunk_no].a, a, b);
+            updateQuickhullExtremePoints(points, chunks[chunk_no].b, a, b);
+        }
+    };
+
+    const auto findExtremePoints = [&](int chunk_no) noexcept {
+        auto &chunk = chunks[chunk_no];
+        const int first = getChunkOffset(chunk_no);
+        chunk.a = first;
+        chunk.b = first;
+        for (int i = first + 1; i < getChunkOffset(chunk_no + 1); ++i)
+        {
+            updateQuickhullExtremePoints(points, i, chunk.a, chunk.b);
+        }
+    };
+
+    const auto countSides = [&](int chunk_no) noexcept {
+        int a, b;
+        getExtremePoints(a, b);
+        int lower_size = 0;
+        int upper_size = 0;
+        for (int i = getChunkOffset(chunk_no); i < getChunkOffset(chunk_no + 1); ++i)
+        {
+            const int side = getQuickhullSide(points, a, b, i);
+            lower_size += side < 0;
+            upper_size += side > 0;
+        }
+        chunks[chunk_no].lower_size = lower_size;
+        chunks[chunk_no].upper_size = upper_size;
+    };
+
+    // Points below (a, b) are stored at the front of the index buffer, points above it at the back in reverse order
+    const auto scatterSides = [&](int chunk_no) noexcept {
+        int a, b;
+        getExtremePoints(a, b);
+        int lower_end = 0;
+        int upper_first = n;
+        for (int previous_chunk_no = 0; previous_chunk_no < chunk_no; ++previous_chunk_no)
+        {
+            lower_end += chunks[previous_chunk_no].lower_size;
+            upper_first -= chunks[previous_chunk_no].upper_size;
+        }
+        for (int i = getChunkOffset(chunk_no); i < getChunkOffset(chunk_no + 1); ++i)
+        {
+            const int side = getQuickhullSide(points, a, b, i);
+            if (side < 0)
+            {
+                indices[lower_end++] = i;
+            }
+            else if (side > 0)
+            {
+                indices[--upper_first] = i;
+            }
+        }
+    };
+
+    const auto splitNode = [&](int node) {
+        auto &node_hull = node_hulls[node];
+        node_hull.clear();
+        const int left = 2 * node + 1;
+        if (node == 0)
+        {
+            int a, b;
+            int lower_size = 0;
+            int upper_size = 0;
+            getExtremePoints(a, b);
+            for (const auto &chunk : chunks)
+            {
+                lower_size += chunk.lower_size;
+                upper_size += chunk.upper_size;
+            }
+            node_frames[left] = {0, lower_size, a, b};
+            node_frames[left + 1] = {n - upper_size, n, b, a};
+            node_hull.push_back(b);
+            return;
+        }
+
+        const auto frame = node_frames[node];
+        if (left >= number_of_nodes || frame.last - frame.first < min_parallel_quickhull_size)
+        {
+            appendQuickhullChain(points, indices.data(), frame.first, frame.last, frame.p, frame.q, task_frames[node],
+                                 node_hull);
+            if (left < number_of_nodes)
+            {
+                node_frames[left] = {frame.first, frame.first, frame.p, frame.q};
+                node_frames[left + 1] = {frame.first, frame.first, frame.p, frame.q};
+            }
+            return;
+        }
+
+        // Ranges of the children are disjoint, so that they can be partitioned concurrently
+        int *middle = nullptr;
+        int *end = nullptr;
+        const int c = partitionQuickhullRange(points, indices.data() + frame.first, indices.data() + frame.last,
+                                              frame.p, frame.q, middle, end);
+        const int middle_offset = static_cast<int>(middle - indices.data());
+        node_frames[left] = {frame.first, middle_offset, frame.p, c};
+        node_frames[left + 1] = {middle_offset, static_cast<int>(end - indices.data()), c, frame.q};
+        node_hull.push_back(c);
+    };
+
+    // Tasks of each chunk pass depend on all tasks of the previous pass, and every node depends on its parent
+    const int number_of_chunk_tasks = 3 * number_of_chunks;
+    ConvexHullTaskDependencies dependencies(workspace.task_done, number_of_chunk_tasks + number_of_nodes);
+    auto &thread_pool = getConvexHullThreadPool(workspace);
+    runParallelTasks(thread_pool, number_of_chunk_tasks + number_of_nodes, number_of_threads, [&](int task_no) {
+        const int pass = std::min(task_no / number_of_chunks, 3);
+        const int pass_task_no = task_no - pass * number_of_chunks;
+        if (pass == 3 && pass_task_no > 0)
+        {
+            dependencies.waitUntilDone(number_of_chunk_tasks + (pass_task_no - 1) / 2);
+        }
+        else
+        {
+            for (int dependency = std::max(pass - 1, 0) * number_of_chunks; dependency < pass * number_of_chunks;
+                 ++dependency)
+            {
+                dependencies.waitUntilDone(dependency);
+            }
+        }
+
+        switch (pass)
+        {
+        case 0:
+            findExtremePoints(pass_task_no);
+            break;
+        case 1:
+            countSides(pass_task_no);
+            break;
+        case 2:
+            scatterSides(pass_task_no);
+            break;
+        default:
+            splitNode(pass_task_no);
+            break;
+        }
+        dependencies.setDone(task_no);
+    });
+
+    int a, b;
+    getExtremePoints(a, b);
+    hull_indices.push_back(a);
+    if (points[a].x != points[b].x || points[a].y != points[b].y)
+    {
+        appendQuickhullTreeHull(node_hulls, 0, number_of_nodes, hull_indices);
+    }
+}
+
+/// @brief Construct Convex Hull using Quickhull algorithm, which partitions an index buffer in place and discards
+/// interior points early. With number_of_threads other than 1, large inputs are processed on multiple threads.
+template <typename T, typename Points>
+void constructQuickhullConvexHull(const Points &points, Orientation orientation, ConvexHullReturnType return_type,
+                                  ConvexHullWorkspace<T> &workspace, std::vector<int> &hull_indices,
+                                  int number_of_threads = 1)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices,
+                            (number_of_threads == 1) ? ConvexHullAlgorithm::QUICKHULL
+                                                     : ConvexHullAlgorithm::PARALLEL_QUICKHULL,
+                            points.size());
+    hull_indices.clear();
+    int n = static_cast<int>(points.size());
+    if (n < 3)
+    {
+        // Convex Hull is not possible for less than 3 points
+        return;
+    }
+
+    number_of_threads = getNumberOfThreads(number_of_threads);
+    if (number_of_threads > 1 && n >= 2 * min_parallel_quickhull_size)
+    {
+        appendParallelQuickhullConvexHull(points, workspace, hull_indices, number_of_threads);
+        applyOrientationAndReturnType(hull_indices, orientation, return_type);
+        return;
+    }
+
+    // Find the lexicographically smallest and largest points, which are both hull vertices
+    CONVEX_HULL_STAGE(PARTITION);
+    int a = 0;
+    int b = 0;
+    for (int i = 1; i < n; ++i)
+    {
+        updateQuickhullExtremePoints(points, i, a, b);
+    }
+
+    hull_indices.push_back(a);
+    if (points[a].x == points[b].x && points[a].y == points[b].y)
+    {
+        // All points coincide
+        applyOrientationAndReturnType(hull_indices, orientation, return_type);
+        return;
+    }
+
+    // Store points below (a, b) at the front of the index buffer, and points above it at the back in reverse order
+    auto &indices = workspace.indices;
+    indices.resize(n);
+    int lower_end = 0;
+    int upper_first = n;
+    for (int i = 0; i < n; ++i)
+    {
+        const int side = getQuickhullSide(points, a, b, i);
+        if (side < 0)
+        {
+            indices[lower_end++] = i;
+        }
+        else if (side > 0)
+        {
+            indices[--upper_first] = i;
+        }
+    }
+
+    appendQuickhullChain(points, indices.data(), 0, lower_end, a, b, workspace.frames, hull_indices);
+    hull_indices.push_back(b);
+    appendQuickhullChain(points, indices.data(), upper_first, n, b, a, workspace.frames, hull_indices);
+
+    applyOrientationAndReturnType(hull_indices, orientation, return_type);
+}
+
+/// @brief Construct Convex Hull using Quickhull algorithm
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructQuickhullConvexHull(const Points &points, Orientation orientation,
+                                              ConvexHullReturnType return_type, int number_of_threads = 1)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructQuickhullConvexHull(points, orientation, return_type, workspace, hull_indices, number_of_threads);
+    return hull_indices;
+}
+
+/// @brief Construct an approximate convex hull in O(n + k) time, with k = workspace.approximation_strips, using the
+/// strip bucketing of Bentley, Faust and Preparata. The x-range of the points is cut into k strips of equal width,
+/// and the hull of the lowest and highest point of every strip is returned, a subset of the points that lies inside
+/// the exact hull. Every input point is within workspace.approximation_error of the returned hull, which is the
+/// widest x-range of the points of a strip, and so at most about (max_x - min_x) / k.
+template <typename T, typename Points>
+void constructApproximateConvexHull(const Points &points, Orientation orientation, ConvexHullReturnType return_type,
+                                    ConvexHullWorkspace<T> &workspace, std::vector<int> &hull_indices)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, ConvexHullAlgorithm::APPROXIMATE, points.size());
+    hull_indices.clear();
+    workspace.approximation_error = 0;
+    int n = static_cast<int>(points.size());
+    if (n < 3)
+    {
+        // Convex Hull is not possible for less than 3 points
+        return;
+    }
+
+    // Find the x-range that the strips divide
+    CONVEX_HULL_STAGE(PARTITION);
+    T min_x = points[0].x;
+    T max_x = points[0].x;
+    for (int i = 1; i < n; ++i)
+    {
+        const T x = points[i].x;
+        min_x = (x < min_x) ? x : min_x;
+        max_x = (max_x < x) ? x : max_x;
+    }
+
+    // Keep the lowest and highest point of every strip, and the x-range of its points. A point between the two lies
+    // within that x-range of the segment joining them, so the bound holds even where rounding moves a point into a
+    // neighbouring strip.
+    const int number_of_strips = std::max(1, std::min(workspace.approximation_strips, n));
+    const Real<T> origin = static_cast<Real<T>>(min_x);
+    const Real<T> width = static_cast<Real<T>>(max_x) - origin;
+    const Real<T> scale = (width > 0) ? number_of_strips / width : 0;
+    auto &strips = workspace.strips;
+    strips.assign(number_of_strips, ConvexHullStrip<T>());
+    for (int i = 0; i < n; ++i)
+    {
+        const auto &point = points[i];
+        const int strip_no =
+            std::min(static_cast<int>((static_cast<Real<T>>(point.x) - origin) * scale), number_of_strips - 1);
+        auto &strip = strips[strip_no];
+        if (strip.bottom < 0)
+        {
+            strip = {i, i, point.y, point.y, point.x, point.x};
+            continue;
+        }
+        if (point.y < strip.bottom_y)
+        {
+            strip.bottom = i;
+            strip.bottom_y = point.y;
+        }
+        else if (strip.top_y < point.y)
+        {
+            strip.top = i;
+            strip.top_y = point.y;
+        }
+        strip.min_x = (point.x < strip.min_x) ? point.x : strip.min_x;
+        strip.max_x = (strip.max_x < point.x) ? point.x : strip.max_x;
+    }
+
+    // Points of a strip are to the right of those of the strips before it, so listing the two points of every strip
+    // ordered by (x, y) lets the monotone chain detect the order in O(k) instead of sorting
+    auto &candidates = workspace.indices;
+    candidates.clear();
+    Real<T> error = 0;
+    for (const auto &strip : strips)
+    {
+        if (strip.bottom < 0)
+        {
+            continue;
+        }
+        const auto &bottom = points[strip.bottom];
+        const auto &top = points[strip.top];
+        if (strip.bottom == strip.top)
+        {
+            candidates.push_back(strip.bottom);
+        }
+        else if (bottom.x <= top.x)
+        {
+            candidates.push_back(strip.bottom);
+            candidates.push_back(strip.top);
+        }
+        else
+        {
+            candidates.push_back(strip.top);
+            candidates.push_back(strip.bottom);
+        }
+        error = std::max(error, static_cast<Real<T>>(strip.max_x) - static_cast<Real<T>>(strip.min_x));
+    }
+    appendMonotoneChainConvexHull(points, candidates.data(), candidates.data() + candidates.size(), hull_indices);
+
+    // Round the bound up, so that it also covers the exact x-ranges
+    workspace.approximation_error =
+        (error > 0) ? std::nextafter(error, std::numeric_limits<Real<T>>::infinity()) : error;
+
+    applyOrientationAndReturnType(hull_indices, orientation, return_type);
+}
+
+/// @brief Construct an approximate convex hull from number_of_strips strips, storing the distance within which it
+/// contains every point in approximation_error
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructApproximateConvexHull(const Points &points, Orientation orientation,
+                                                ConvexHullReturnType return_type, Real<T> &approximation_error,
+                                                int number_of_strips = 1 << 10)
+{
+    ConvexHullWorkspace<T> workspace;
+    workspace.approximation_strips = number_of_strips;
+    std::vector<int> hull_indices;
+    constructApproximateConvexHull(points, orientation, return_type, workspace, hull_indices);
+    approximation_error = workspace.approximation_error;
+    return hull_indices;
+}
+
+/// @brief Algorithm and interior point filter selected by ConvexHullAlgorithm::AUTO
+struct ConvexHullSelection
+{
+    ConvexHullAlgorithm algorithm;
+    ConvexHullFilter filter;
+    double survivor_fraction; // Fraction of sampled points that survived the octagon filter of the sample
+};
+
+/// @brief Returns the parallel variant of a serial algorithm, if there is one
+inline ConvexHullAlgorithm getParallelConvexHullAlgorithm(ConvexHullAlgorithm algorithm) noexcept
+{
+    switch (algorithm)
+    {
+    case ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN:
+        return ConvexHullAlgorithm::PARALLEL_ANDREW_MONOTONE_CHAIN;
+    case ConvexHullAlgorithm::QUICKHULL:
+        return ConvexHullAlgorithm::PARALLEL_QUICKHULL;
+    default:
+        return algorithm;
+    }
+}
+
+/// @brief Selects algorithm and filter of ConvexHullAlgorithm::AUTO in O(sample_size) time. Points sampled at a fixed
+/// stride tell whether the input is ordered along an axis, which Andrew's Monotone Chain hulls in O(n) without
+/// filtering, and how many points survive the octagon filter, which is few for filled shapes and all for points in
+/// convex position. Quickhull is selected for few survivors and Andrew's Monotone Chain otherwise, as Quickhull
+/// degrades when most points are hull vertices.
+template <typename T, typename Points>
+ConvexHullSelection selectConvexHullAlgorithm(const Points &points, const ConvexHullAutoThresholds &thresholds,
+                                              ConvexHullWorkspace<T> &workspace)
+{
+    const int n = static_cast<int>(points.size());
+    if (n <= thresholds.max_small_size)
+    {
+        return {ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, ConvexHullFilter::NONE, 1.0};
+    }
+
+    // Sample indices at a fixed stride, keeping their order
+    const int sample_size = std::min(std::max(thresholds.sample_size, 8), n);
+    auto &sample = workspace.indices;
+    sample.resize(sample_size);
+    for (int i = 0; i < sample_size; ++i)
+    {
+        sample[i] = static_cast<int>(static_cast<long long>(n) * i / sample_size);
+    }
+
+    // Check whether the sample is ordered by (y, x) or (x, y), ascending or descending
+    const auto is_ordered = [&](auto &&is_less) {
+        bool is_ascending = true;
+        bool is_descending = true;
+        for (int i = 1; i < sample_size && (is_ascending || is_descending); ++i)
+        {
+            const auto &previous = points[sample[i - 1]];
+            const auto &current = points[sample[i]];
+            is_ascending = is_ascending && !is_less(current, previous);
+            is_descending = is_descending && !is_less(previous, current);
+        }
+        return is_ascending || is_descending;
+    };
+    const bool is_presorted = is_ordered([](const auto &p1, const auto &p2) noexcept {
+        return p1.y < p2.y || (p1.y == p2.y && p1.x < p2.x);
+    }) || is_ordered([](const auto &p1, const auto &p2) noexcept {
+        return p1.x < p2.x || (p1.x == p2.x && p1.y < p2.y);
+    });
+
+    // Estimate the fraction of points surviving the octagon filter from the sample
+    const int *const sample_end =
+        filterInteriorPoints(points, sample.data(), sample.data() + sample_size, ConvexHullFilter::OCTAGON,
+                             workspace.polygon);
+    const double survivor_fraction = static_cast<double>(sample_end - sample.data()) / sample_size;
+
+    ConvexHullSelection selection;
+    selection.survivor_fraction = survivor_fraction;
+    selection.filter =
+        (!is_presorted && n >= thresholds.min_filter_size && survivor_fraction < thresholds.max_filter_fraction)
+            ? ConvexHullFilter::OCTAGON
+            : ConvexHullFilter::NONE;
+    selection.algorithm = (is_presorted || survivor_fraction >= thresholds.max_quickhull_fraction)
+                              ? ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN
+                              : ConvexHullAlgorithm::QUICKHULL;
+    if (n >= thresholds.min_parallel_size && getNumberOfThreads(0) > 1)
+    {
+        selection.algorithm = getParallelConvexHullAlgorithm(selection.algorithm);
+    }
+    return selection;
+}
+
+/// @brief Selects algorithm and filter of ConvexHullAlgorithm::AUTO
+template <typename Points, typename T = PointCoordinate<Points>>
+ConvexHullSelection selectConvexHullAlgorithm(const Points &points,
+                                              const ConvexHullAutoThresholds &thresholds = ConvexHullAutoThresholds())
+{
+    ConvexHullWorkspace<T> workspace;
+    return selectConvexHullAlgorithm(points, thresholds, workspace);
+}
+
+/// @brief Main method that calls relevant functions based on provided inputs, writing hull indices into
+/// hull_indices and reusing scratch buffers of the workspace. Points may be any point container, such as a PointView
+/// or PointSpan over memory owned by the caller, which avoids copying it into std::vector<Point<T>>.
+template <typename T, typename Points>
+void constructConvexHull(const Points &points, std::vector<int> &hull_indices, ConvexHullWorkspace<T> &workspace,
+                         ConvexHullAlgorithm algorithm = ConvexHullAlgorithm::GRAHAM_SCAN,
+                         Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                         ConvexHullReturnType return_type = ConvexHullReturnType::OPEN,
+                         ConvexHullFilter filter = ConvexHullFilter::NONE)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, algorithm, points.size());
+    assert(hasExactCoordinates(points) && "integer coordinates exceed the magnitude of exact cross products");
+    hull_indices.clear();
+    if (orientation == Orientation::COLLINEAR)
+    {
+        std::cerr << "Orientation::COLLINEAR only supported internally. Returning empty hull." << std::endl;
+        return;
+    }
+
+    // Let AUTO select the algorithm, and the filter unless one is given
+    if (algorithm == ConvexHullAlgorithm::AUTO)
+    {
+        CONVEX_HULL_STAGE(SELECTION);
+        const auto selection = selectConvexHullAlgorithm(points, workspace.auto_thresholds, workspace);
+        algorithm = selection.algorithm;
+        filter = (filter == ConvexHullFilter::NONE) ? selection.filter : filter;
+    }
+
+    // Discard interior points, then run the selected algorithm over survivors and map indices back; Melkman's
+    // algorithm is exempt, since removing points from a simple polyline may make it self-intersecting
+    if (filter != ConvexHullFilter::NONE && algorithm != ConvexHullAlgorithm::MELKMAN)
+    {
+        CONVEX_HULL_STAGE(FILTER);
+        auto &survivor_indices = workspace.survivor_indices;
+        filterInteriorPoints(points, filter, workspace, survivor_indices);
+        CONVEX_HULL_COUNT(number_of_filtered_points, static_cast<long long>(points.size() - survivor_indices.size()));
+        if (survivor_indices.size() < points.size())
+        {
+            auto &survivors = workspace.survivors;
+            survivors.clear();
+            for (const auto index : survivor_indices)
+            {
+                survivors.push_back(points[index]);
+            }
+
+            constructConvexHull(survivors, hull_indices, workspace, algorithm, orientation, return_type);
+            CONVEX_HULL_STAGE(BACK_MAPPING);
+            for (auto &index : hull_indices)
+            {
+                index = survivor_indices[index];
+            }
+            return;
+        }
+    }
+
+    switch (algorithm)
+    {
+    case ConvexHullAlgorithm::GRAHAM_SCAN: {
+        return constructGrahamScanConvexHull(points, orientation, return_type, workspace, hull_indices);
+    }
+    case ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN: {
+        return constructAndrewMonotoneChainConvexHull(points, orientation, return_type, workspace, hull_indices);
+    }
+    case ConvexHullAlgorithm::JARVIS_MARCH: {
+        return constructJarvisMarchConvexHull(points, orientation, return_type, workspace, hull_indices);
     }
     case ConvexHullAlgorithm::CHAN: {
-        return constructChanConvexHull(points, orientation, return_type);
+        return constructChanConvexHull(points, orientation, return_type, workspace, hull_indices);
+    }
+    case ConvexHullAlgorithm::PARALLEL_ANDREW_MONOTONE_CHAIN: {
+        return constructParallelAndrewMonotoneChainConvexHull(points, orientation, return_type, workspace,
+                                                              hull_indices);
+    }
+    case ConvexHullAlgorithm::QUICKHULL: {
+        return constructQuickhullConvexHull(points, orientation, return_type, workspace, hull_indices);
+    }
+    case ConvexHullAlgorithm::PARALLEL_QUICKHULL: {
+        return constructQuickhullConvexHull(points, orientation, return_type, workspace, hull_indices, 0);
+    }
+    case ConvexHullAlgorithm::MELKMAN: {
+        return constructMelkmanConvexHull(points, orientation, return_type, workspace, hull_indices);
+    }
+    case ConvexHullAlgorithm::APPROXIMATE: {
+        return constructApproximateConvexHull(points, orientation, return_type, workspace, hull_indices);
+    }
+    default: {
+        return;
+    }
+    }
+}
+
+/// @brief Main method that calls relevant functions based on provided inputs
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructConvexHull(const Points &points,
+                                     ConvexHullAlgorithm algorithm = ConvexHullAlgorithm::GRAHAM_SCAN,
+                                     Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                                     ConvexHullReturnType return_type = ConvexHullReturnType::OPEN,
+                                     ConvexHullFilter filter = ConvexHullFilter::NONE)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructConvexHull(points, hull_indices, workspace, algorithm, orientation, return_type, filter);
+    return hull_indices;
+}
+
+/// @brief Main method for structure-of-arrays points. Filtering and Jarvis March operate on the arrays directly,
+/// other algorithms receive the (filtered) points as Point<T> values.
+template <typename T>
+void constructConvexHull(const PointArray<T> &points, std::vector<int> &hull_indices,
+                         ConvexHullWorkspace<T> &workspace,
+                         ConvexHullAlgorithm algorithm = ConvexHullAlgorithm::GRAHAM_SCAN,
+                         Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                         ConvexHullReturnType return_type = ConvexHullReturnType::OPEN,
+                         ConvexHullFilter filter = ConvexHullFilter::NONE)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, algorithm, points.size());
+    assert(hasExactCoordinates(points) && "integer coordinates exceed the magnitude of exact cross products");
+    hull_indices.clear();
+    if (orientation == Orientation::COLLINEAR)
+    {
+        std::cerr << "Orientation::COLLINEAR only supported internally. Returning empty hull." << std::endl;
+        return;
+    }
+
+    // Let AUTO select the algorithm, and the filter unless one is given
+    if (algorithm == ConvexHullAlgorithm::AUTO)
+    {
+        CONVEX_HULL_STAGE(SELECTION);
+        const auto selection = selectConvexHullAlgorithm(points, workspace.auto_thresholds, workspace);
+        algorithm = selection.algorithm;
+        filter = (filter == ConvexHullFilter::NONE) ? selection.filter : filter;
+    }
+
+    if (algorithm == ConvexHullAlgorithm::JARVIS_MARCH && filter == ConvexHullFilter::NONE)
+    {
+        return constructJarvisMarchConvexHull(points, orientation, return_type, workspace, hull_indices);
+    }
+    if (algorithm == ConvexHullAlgorithm::MELKMAN)
+    {
+        // Removing points from a simple polyline may make it self-intersecting, so no filter is applied
+        filter = ConvexHullFilter::NONE;
+    }
+
+    // Discard interior points, then run the selected algorithm over survivors and map indices back
+    CONVEX_HULL_STAGE(FILTER);
+    auto &survivor_indices = workspace.survivor_indices;
+    filterInteriorPoints(points, filter, workspace, survivor_indices);
+    CONVEX_HULL_COUNT(number_of_filtered_points, static_cast<long long>(points.size() - survivor_indices.size()));
+    if (algorithm == ConvexHullAlgorithm::JARVIS_MARCH)
+    {
+        auto &survivors = workspace.survivor_array;
+        survivors.x.clear();
+        survivors.y.clear();
+        for (const auto index : survivor_indices)
+        {
+            survivors.push_back(points[index]);
+        }
+        constructJarvisMarchConvexHull(survivors, orientation, return_type, workspace, hull_indices);
+    }
+    else
+    {
+        auto &survivors = workspace.survivors;
+        survivors.clear();
+        for (const auto index : survivor_indices)
+        {
+            survivors.push_back(points[index]);
+        }
+        constructConvexHull(survivors, hull_indices, workspace, algorithm, orientation, return_type);
+    }
+
+    CONVEX_HULL_STAGE(BACK_MAPPING);
+    for (auto &index : hull_indices)
+    {
+        index = survivor_indices[index];
+    }
+}
+
+/// @brief Main method for structure-of-arrays points
+template <typename T>
+std::vector<int> constructConvexHull(const PointArray<T> &points,
+                                     ConvexHullAlgorithm algorithm = ConvexHullAlgorithm::GRAHAM_SCAN,
+                                     Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                                     ConvexHullReturnType return_type = ConvexHullReturnType::OPEN,
+                                     ConvexHullFilter filter = ConvexHullFilter::NONE)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    constructConvexHull(points, hull_indices, workspace, algorithm, orientation, return_type, filter);
+    return hull_indices;
+}
+
+/// @brief Hull indices of a fixed-size point set, stored inline in an array of the given capacity, so that neither
+/// construction nor copies allocate
+template <std::size_t Capacity> class FixedConvexHull
+{
+  public:
+    constexpr std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    static constexpr std::size_t capacity() noexcept
+    {
+        return Capacity;
+    }
+
+    constexpr int operator[](std::size_t position) const noexcept
+    {
+        return indices_[position];
+    }
+
+    constexpr const int *begin() const noexcept
+    {
+        return indices_.data();
+    }
+
+    constexpr const int *end() const noexcept
+    {
+        return indices_.data() + size_;
+    }
+
+    constexpr void push_back(int index) noexcept
+    {
+        indices_[size_++] = index;
+    }
+
+  private:
+    std::array<int, Capacity> indices_{};
+    std::size_t size_ = 0;
+};
+
+/// @brief Returns the number of bits needed to represent value
+constexpr int getBitWidth(std::uint64_t value) noexcept
+{
+    int width = 0;
+    for (; value > 0; value >>= 1)
+    {
+        ++width;
+    }
+    return width;
+}
+
+/// @brief Calls exchange(i, j) for every compare-exchange of Batcher's odd-even merge sort of n items, which sorts any
+/// input in O(n log^2 n) exchanges that do not depend on the data
+template <typename Exchange> constexpr void forEachSortingNetworkExchange(int n, Exchange &&exchange) noexcept
+{
+    for (int p = 1; p < n; p *= 2)
+    {
+        for (int k = p; k >= 1; k /= 2)
+        {
+            for (int j = k % p; j + k < n; j += 2 * k)
+            {
+                for (int i = 0; i < std::min(k, n - j - k); ++i)
+                {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                    {
+                        exchange(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// @brief Returns the number of compare-exchanges of the sorting network of n items
+constexpr int getSortingNetworkSize(int n) noexcept
+{
+    int size = 0;
+    forEachSortingNetworkExchange(n, [&](int, int) { ++size; });
+    return size;
+}
+
+/// @brief Returns the compare-exchanges of the sorting network of N items as pairs of positions
+template <std::size_t N>
+constexpr std::array<std::array<int, 2>, getSortingNetworkSize(N)> getSortingNetwork() noexcept
+{
+    std::array<std::array<int, 2>, getSortingNetworkSize(N)> network{};
+    int size = 0;
+    forEachSortingNetworkExchange(static_cast<int>(N), [&](int i, int j) {
+        network[size][0] = i;
+        network[size][1] = j;
+        ++size;
+    });
+    return network;
+}
+
+/// @brief Compare-exchanges of the sorting network of N items, computed at compile time
+template <std::size_t N> constexpr auto sorting_network = getSortingNetwork<N>();
+
+/// @brief Sorts the positions of a fixed-size point set in (y, x) order. Every position is packed with its y
+/// coordinate into one unsigned key, whose high bits have the order of the coordinate, so that the sorting network of N
+/// items exchanges single integers with conditional moves rather than with branches that the data would make
+/// unpredictable. Keys that drop low bits of y to make room for the position may tie, so an insertion sort with the
+/// exact comparisons then settles the few positions out of order, like the radix sort. At run time, coordinates of up
+/// to 64 bits are keyed by their bits; during constant evaluation, and for wider coordinates, a coordinate is keyed by
+/// the number of smaller coordinates.
+template <typename T, std::size_t N>
+constexpr void sortFixedPoints(const std::array<Point<T>, N> &points, int (&order)[N]) noexcept
+{
+    constexpr int index_bits = getBitWidth(N - 1);
+    constexpr std::uint64_t index_mask = (std::uint64_t(1) << index_bits) - 1;
+    constexpr bool has_radix_keys = std::is_integral<T>::value || sizeof(T) <= sizeof(double);
+    std::uint64_t keys[N]{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        std::uint64_t key = 0;
+        if (has_radix_keys && !CONVEX_HULL_IS_CONSTANT_EVALUATED())
+        {
+            key = getRadixKey(points[i].y);
+        }
+        else
+        {
+            for (std::size_t j = 0; j < N; ++j)
+            {
+                key += points[j].y < points[i].y;
+            }
+        }
+        key = (sizeof(T) <= sizeof(std::uint32_t) || !has_radix_keys || CONVEX_HULL_IS_CONSTANT_EVALUATED())
+                  ? key << index_bits
+                  : key & ~index_mask;
+        keys[i] = key | i;
+    }
+
+    for (const auto &exchange : sorting_network<N>)
+    {
+        const std::uint64_t a = keys[exchange[0]];
+        const std::uint64_t b = keys[exchange[1]];
+        keys[exchange[0]] = (b < a) ? b : a;
+        keys[exchange[1]] = (b < a) ? a : b;
+    }
+
+    const auto is_less = [&](int a, int b) constexpr noexcept -> bool {
+        return points[a] < points[b] || (points[a] == points[b] && a < b);
+    };
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const int item = static_cast<int>(keys[i] & index_mask);
+        std::size_t hole = i;
+        for (; hole > 0 && is_less(item, order[hole - 1]); --hole)
+        {
+            order[hole] = order[hole - 1];
+        }
+        order[hole] = item;
+    }
+}
+
+/// @brief Construct convex hull of a fixed number of points, such as the corners of a box or a few contact points,
+/// without heap allocation. Points are sorted by a sorting network specialized on N, and the hull is built with
+/// Andrew's Monotone Chain in fixed-size buffers, so it has the vertices of ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN,
+/// up to which of several equal points is reported, and can be evaluated at compile time. Meant for N up to a few
+/// dozen. Orientation::COLLINEAR gives an empty hull.
+template <typename T, std::size_t N>
+constexpr FixedConvexHull<N + 1> constructConvexHull(const std::array<Point<T>, N> &points,
+                                                     Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                                                     ConvexHullReturnType return_type = ConvexHullReturnType::OPEN)
+{
+    FixedConvexHull<N + 1> hull_indices;
+
+    // Convex Hull is not possible for less than 3 points
+    if constexpr (N >= 3)
+    {
+        if (orientation == Orientation::COLLINEAR)
+        {
+            return hull_indices;
+        }
+
+        constexpr int n = static_cast<int>(N);
+        int order[N]{};
+        sortFixedPoints(points, order);
+        T x[N]{};
+        T y[N]{};
+        for (int i = 0; i < n; ++i)
+        {
+            x[i] = points[order[i]].x;
+            y[i] = points[order[i]].y;
+        }
+
+        const auto get_sign = [&](int p1, int p2, int p3) constexpr noexcept -> int {
+            return getUncountedOrientationSign(Point<T>(x[p1], y[p1]), Point<T>(x[p2], y[p2]),
+                                               Point<T>(x[p3], y[p3]));
+        };
+
+        // The lowest and highest points split the others into the right and the left chain, and points on neither
+        // side are not hull vertices. Sides are collected without branches, which the data would make unpredictable.
+        int side_signs[N]{};
+        for (int i = 1; i < n - 1; ++i)
+        {
+            side_signs[i] = get_sign(0, n - 1, i);
+        }
+        int sides[2][N]{};
+        int side_sizes[2] = {0, 0};
+        for (int i = 1; i < n - 1; ++i)
+        {
+            sides[0][side_sizes[0]] = i;
+            side_sizes[0] += side_signs[i] < 0;
+            sides[1][side_sizes[1]] = n - 1 - i;
+            side_sizes[1] += side_signs[n - 1 - i] > 0;
+        }
+
+        // Build the right chain from the lowest to the highest point and the left chain back, turning left
+        int chain[N + 1]{};
+        int k = 0;
+        const auto append = [&](int i, int t) constexpr noexcept {
+            while (k >= t && get_sign(chain[k - 2], chain[k - 1], i) <= 0)
+            {
+                --k;
+            }
+            chain[k++] = i;
+        };
+        chain[k++] = 0;
+        for (int j = 0; j < side_sizes[0]; ++j)
+        {
+            append(sides[0][j], 2);
+        }
+        append(n - 1, 2);
+        const int t = k + 1;
+        for (int j = 0; j < side_sizes[1]; ++j)
+        {
+            append(sides[1][j], t);
+        }
+        append(0, t);
+
+        // Points that all coincide leave the lowest and the highest point, which are the same vertex
+        if (k == 3 && x[chain[0]] == x[chain[1]] && y[chain[0]] == y[chain[1]])
+        {
+            k = 2;
+        }
+
+        // The last chain vertex repeats the first one
+        if (orientation == Orientation::CLOCKWISE)
+        {
+            for (int i = k - 2; i >= 0; --i)
+            {
+                hull_indices.push_back(order[chain[i]]);
+            }
+        }
+        else
+        {
+            for (int i = 0; i < k - 1; ++i)
+            {
+                hull_indices.push_back(order[chain[i]]);
+            }
+        }
+        if (return_type == ConvexHullReturnType::ENCLOSED && !hull_indices.empty())
+        {
+            hull_indices.push_back(hull_indices[0]);
+        }
+    }
+    return hull_indices;
+}
+
+/// @brief Derives thresholds of ConvexHullAlgorithm::AUTO on the running machine, by timing the candidate algorithms
+/// on synthetic inputs of up to max_size points, taking the fastest of the given number of repetitions. Inputs are
+/// uniform in a disk, with a varying fraction of points moved onto its boundary circle. The result can be stored and
+/// assigned to ConvexHullWorkspace::auto_thresholds. For the default size, calibration takes at most about 3 seconds,
+/// most of them spent comparing the parallel algorithms on machines with more than one hardware thread.
+template <typename T = double>
+ConvexHullAutoThresholds calibrateConvexHullAutoThresholds(int max_size = 1 << 20, int repetitions = 3)
+{
+    ConvexHullAutoThresholds thresholds;
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+
+    std::mt19937_64 generator(12345);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const double pi = std::acos(-1.0);
+    const auto generatePoints = [&](int n, double boundary_fraction) {
+        constexpr double radius = 1 << 20;
+        std::vector<Point<T>> points;
+        points.reserve(n);
+        for (int i = 0; i < n; ++i)
+        {
+            const double angle = 2.0 * pi * uniform(generator);
+            const bool is_on_boundary = uniform(generator) < boundary_fraction;
+            const double distance = is_on_boundary ? radius : radius * std::sqrt(uniform(generator));
+            points.emplace_back(static_cast<T>(distance * std::cos(angle)), static_cast<T>(distance * std::sin(angle)));
+        }
+        return points;
+    };
+
+    // Returns the best time of repeated constructions, each running on at least 2^16 points in total, so that small
+    // inputs are timed above the clock resolution
+    const auto measure = [&](const std::vector<Point<T>> &points, ConvexHullAlgorithm algorithm,
+                             ConvexHullFilter filter) {
+        const int iterations = std::max(1, (1 << 16) / std::max(static_cast<int>(points.size()), 1));
+        double best_seconds = std::numeric_limits<double>::infinity();
+        for (int repetition = 0; repetition < repetitions; ++repetition)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (int iteration = 0; iteration < iterations; ++iteration)
+            {
+                constructConvexHull(points, hull_indices, workspace, algorithm, Orientation::COUNTERCLOCKWISE,
+                                    ConvexHullReturnType::OPEN, filter);
+            }
+            const std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+            best_seconds = std::min(best_seconds, seconds.count());
+        }
+        return best_seconds;
+    };
+
+    // Small inputs are hulled by Andrew's Monotone Chain while it beats Quickhull
+    for (int n = 8; n <= std::min(max_size, 1 << 10); n *= 2)
+    {
+        const auto points = generatePoints(n, 0.0);
+        if (measure(points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, ConvexHullFilter::NONE) >
+            measure(points, ConvexHullAlgorithm::QUICKHULL, ConvexHullFilter::NONE))
+        {
+            break;
+        }
+        thresholds.max_small_size = n;
+    }
+
+    // The filter is applied from the smallest input on which it speeds up Quickhull
+    thresholds.min_filter_size = std::numeric_limits<int>::max();
+    for (int n = 16; n <= std::min(max_size, 1 << 16); n *= 2)
+    {
+        const auto points = generatePoints(n, 0.0);
+        if (measure(points, ConvexHullAlgorithm::QUICKHULL, ConvexHullFilter::OCTAGON) <
+            measure(points, ConvexHullAlgorithm::QUICKHULL, ConvexHullFilter::NONE))
+        {
+            thresholds.min_filter_size = n;
+            break;
+        }
+    }
+
+    // With a growing fraction of points on the boundary, find the sampled survivor fractions at which the filter and
+    // Quickhull stop paying off
+    thresholds.max_filter_fraction = std::numeric_limits<double>::infinity();
+    thresholds.max_quickhull_fraction = std::numeric_limits<double>::infinity();
+    const int n = std::min(max_size, 1 << 16);
+    for (const double boundary_fraction : {0.0, 1.0 / 64, 1.0 / 32, 1.0 / 16, 1.0 / 8, 1.0 / 4, 1.0 / 2, 1.0})
+    {
+        const auto points = generatePoints(n, boundary_fraction);
+        const double survivor_fraction = selectConvexHullAlgorithm(points, thresholds, workspace).survivor_fraction;
+        const double quickhull_filtered = measure(points, ConvexHullAlgorithm::QUICKHULL, ConvexHullFilter::OCTAGON);
+        const double quickhull = measure(points, ConvexHullAlgorithm::QUICKHULL, ConvexHullFilter::NONE);
+        const double monotone_chain_filtered =
+            measure(points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, ConvexHullFilter::OCTAGON);
+        const double monotone_chain =
+            measure(points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, ConvexHullFilter::NONE);
+        if (std::isinf(thresholds.max_filter_fraction) &&
+            std::min(quickhull_filtered, monotone_chain_filtered) > std::min(quickhull, monotone_chain))
+        {
+            thresholds.max_filter_fraction = survivor_fraction;
+        }
+        if (std::isinf(thresholds.max_quickhull_fraction) &&
+            std::min(quickhull_filtered, quickhull) > std::min(monotone_chain_filtered, monotone_chain))
+        {
+            thresholds.max_quickhull_fraction = survivor_fraction;
+        }
+    }
+
+    // Parallel algorithms are used from the smallest input on which they beat the serial selection, both for filled
+    // disks and for points in convex position
+    if (getNumberOfThreads(0) > 1)
+    {
+        thresholds.min_parallel_size = std::numeric_limits<int>::max();
+        for (int size = 1 << 14; size <= max_size; size *= 2)
+        {
+            bool is_faster = true;
+            for (const double boundary_fraction : {0.0, 1.0})
+            {
+                const auto points = generatePoints(size, boundary_fraction);
+                const auto selection = selectConvexHullAlgorithm(points, thresholds, workspace);
+                const double serial = measure(points, selection.algorithm, selection.filter);
+                const double parallel =
+                    measure(points, getParallelConvexHullAlgorithm(selection.algorithm), selection.filter);
+                is_faster = is_faster && parallel < serial;
+            }
+            if (is_faster)
+            {
+                thresholds.min_parallel_size = size;
+                break;
+            }
+        }
+    }
+
+    return thresholds;
+}
+
+/// @brief Sorts points by (y, x), breaking ties by index like appendMonotoneChainConvexHull. Small ranges are sorted
+/// with insertion sort, which avoids the setup cost of introsort.
+template <typename T> void sortIndexedPoints(IndexedPoint<T> *first, IndexedPoint<T> *last) noexcept
+{
+    const auto is_less = [](const IndexedPoint<T> &a, const IndexedPoint<T> &b) noexcept -> bool {
+        return a.y < b.y || (a.y == b.y && (a.x < b.x || (a.x == b.x && a.index < b.index)));
+    };
+    if (last - first > 32)
+    {
+        std::sort(first, last, is_less);
+        return;
+    }
+    for (IndexedPoint<T> *it = first + 1; it < last; ++it)
+    {
+        const IndexedPoint<T> item = *it;
+        IndexedPoint<T> *hole = it;
+        for (; hole != first && is_less(item, *(hole - 1)); --hole)
+        {
+            *hole = *(hole - 1);
+        }
+        *hole = item;
+    }
+}
+
+/// @brief Appends counterclockwise hull of n points sorted by sortIndexedPoints to hull_indices using Andrew's
+/// Monotone Chain algorithm, giving the same hull as appendMonotoneChainConvexHull
+template <typename T>
+void appendSortedMonotoneChainConvexHull(const IndexedPoint<T> *points, int n, std::vector<int> &hull_indices)
+{
+    if (n < 2)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            hull_indices.push_back(points[i].index);
+        }
+        return;
+    }
+
+    // The hull first holds positions of its vertices in points, which are replaced by their indices at the end
+    const auto offset = hull_indices.size();
+    hull_indices.resize(offset + 2 * n);
+    int *hull = hull_indices.data() + offset;
+
+    // Compute lower hull
+    int k = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        while (k >= 2 && getOrientationSign(points[hull[k - 2]].getPoint(), points[hull[k - 1]].getPoint(),
+                                            points[i].getPoint()) <= 0)
+        {
+            --k;
+            CONVEX_HULL_COUNT(number_of_hull_pops, 1);
+        }
+        hull[k++] = i;
+    }
+
+    // Compute upper hull
+    for (int i = n - 2, t = k + 1; i >= 0; --i)
+    {
+        while (k >= t && getOrientationSign(points[hull[k - 2]].getPoint(), points[hull[k - 1]].getPoint(),
+                                            points[i].getPoint()) <= 0)
+        {
+            --k;
+            CONVEX_HULL_COUNT(number_of_hull_pops, 1);
+        }
+        hull[k++] = i;
+    }
+
+    // Points that all coincide collapse both chains onto the first and the last point, keep a single vertex
+    if (k == 3 && points[hull[0]].x == points[hull[1]].x && points[hull[0]].y == points[hull[1]].y)
+    {
+        k = 2;
+    }
+
+    for (int j = 0; j < k - 1; ++j)
+    {
+        hull[j] = points[hull[j]].index;
+    }
+    hull_indices.resize(offset + k - 1);
+}
+
+/// @brief Counterclockwise view of the vertices of a hull returned by constructConvexHull, of either orientation and
+/// return type, which wraps around so that vertex i + h is vertex i
+template <typename Points> struct CounterclockwiseHull
+{
+    CounterclockwiseHull(const Points &points, const int *indices, int h) noexcept
+        : points(points), indices(indices), h(h)
+    {
+        if (h > 1 && indices[0] == indices[h - 1])
+        {
+            --this->h;
+        }
+        is_reversed = this->h > 2 && getOrientationSign(points[indices[0]], points[indices[1]], points[indices[2]]) < 0;
+    }
+
+    int size() const noexcept
+    {
+        return h;
+    }
+
+    /// @brief Returns index of vertex i into the points
+    int getIndex(int i) const noexcept
+    {
+        i %= h;
+        return indices[is_reversed ? (h - i) % h : i];
+    }
+
+    decltype(auto) operator[](int i) const noexcept
+    {
+        return points[getIndex(i)];
+    }
+
+    const Points &points;
+    const int *indices;
+    int h;
+    bool is_reversed = false;
+};
+
+/// @brief Pair of points at maximum distance from each other, as indices into the points
+template <typename T> struct HullDiameter
+{
+    int first = -1;
+    int second = -1;
+    Accumulator<T> squared_distance = 0;
+};
+
+/// @brief Minimum width of a hull, the distance from the hull edge (edge_first, edge_second) to the farthest vertex,
+/// as indices into the points
+template <typename T> struct HullWidth
+{
+    int edge_first = -1;
+    int edge_second = -1;
+    int vertex = -1;
+    Real<T> width = 0;
+};
+
+/// @brief Rectangle enclosing a hull with counterclockwise corners, the first two of which lie on the line through a
+/// hull edge. Width is measured along that edge, and height across it.
+template <typename T> struct OrientedBoundingBox
+{
+    std::array<Point<Real<T>>, 4> corners = {Point<Real<T>>(0, 0), Point<Real<T>>(0, 0), Point<Real<T>>(0, 0),
+                                             Point<Real<T>>(0, 0)};
+    Real<T> width = 0;
+    Real<T> height = 0;
+    Real<T> area = 0;
+};
+
+/// @brief Diameter, minimum width and minimum-area bounding box of one hull
+template <typename T> struct HullGeometry
+{
+    HullDiameter<T> diameter;
+    HullWidth<T> width;
+    OrientedBoundingBox<T> bounding_box;
+};
+
+/// @brief Advances j to the hull vertex farthest from the line through edge (i, i + 1), the antipodal vertex that
+/// rotating calipers keep for consecutive edges
+template <typename Points> void advanceAntipodalVertex(const CounterclockwiseHull<Points> &hull, int i, int &j) noexcept
+{
+    while (compareCrossProducts(hull[i], hull[i + 1], hull[j + 1], hull[j]) > 0)
+    {
+        ++j;
+    }
+}
+
+/// @brief Returns the pair of hull vertices at maximum distance in O(h), by rotating calipers over antipodal pairs
+template <typename Points, typename T = PointCoordinate<Points>>
+HullDiameter<T> findHullDiameter(const CounterclockwiseHull<Points> &hull) noexcept
+{
+    HullDiameter<T> diameter;
+    const int h = hull.size();
+    if (h == 0)
+    {
+        return diameter;
+    }
+
+    diameter.first = diameter.second = hull.getIndex(0);
+    const auto update = [&](int i, int j) noexcept {
+        const auto squared_distance = squaredDistance<T>(hull[i], hull[j]);
+        if (squared_distance > diameter.squared_distance)
+        {
+            diameter = {hull.getIndex(i), hull.getIndex(j), squared_distance};
+        }
+    };
+
+    if (h <= 2)
+    {
+        update(0, h - 1);
+        return diameter;
+    }
+
+    int j = 1;
+    for (int i = 0; i < h; ++i)
+    {
+        advanceAntipodalVertex(hull, i, j);
+        update(i, j);
+        update(i + 1, j);
+    }
+    return diameter;
+}
+
+/// @brief Returns the pair of points at maximum distance among the hull vertices
+template <typename Points, typename T = PointCoordinate<Points>>
+HullDiameter<T> findHullDiameter(const Points &points, const std::vector<int> &hull_indices) noexcept
+{
+    return findHullDiameter(
+        CounterclockwiseHull<Points>(points, hull_indices.data(), static_cast<int>(hull_indices.size())));
+}
+
+/// @brief Returns the minimum width of the hull in O(h), attained between a hull edge and its antipodal vertex
+template <typename Points, typename T = PointCoordinate<Points>>
+HullWidth<T> findHullWidth(const CounterclockwiseHull<Points> &hull) noexcept
+{
+    HullWidth<T> width;
+    const int h = hull.size();
+    if (h == 0)
+    {
+        return width;
+    }
+    if (h <= 2)
+    {
+        width.edge_first = width.vertex = hull.getIndex(0);
+        width.edge_second = hull.getIndex(h - 1);
+        return width;
+    }
+
+    int j = 1;
+    for (int i = 0; i < h; ++i)
+    {
+        advanceAntipodalVertex(hull, i, j);
+        const Point<T> p1 = hull[i];
+        const Point<T> p2 = hull[i + 1];
+        const Real<T> length = std::hypot(Real<T>(p2.x) - Real<T>(p1.x), Real<T>(p2.y) - Real<T>(p1.y));
+        const Real<T> distance = Real<T>(crossProduct<T>(p1, p2, hull[j])) / length;
+        if (i == 0 || distance < width.width)
+        {
+            width = {hull.getIndex(i), hull.getIndex(i + 1), hull.getIndex(j), distance};
+        }
+    }
+    return width;
+}
+
+/// @brief Returns the minimum width of the hull
+template <typename Points, typename T = PointCoordinate<Points>>
+HullWidth<T> findHullWidth(const Points &points, const std::vector<int> &hull_indices) noexcept
+{
+    return findHullWidth(
+        CounterclockwiseHull<Points>(points, hull_indices.data(), static_cast<int>(hull_indices.size())));
+}
+
+/// @brief Returns the minimum-area rectangle enclosing the hull in O(h). One side of the optimal rectangle is flush
+/// with a hull edge, so rotating calipers keep the vertices extreme along each edge, against it and across it.
+template <typename Points, typename T = PointCoordinate<Points>>
+OrientedBoundingBox<T> findMinimumAreaBoundingBox(const CounterclockwiseHull<Points> &hull) noexcept
+{
+    using A = Accumulator<T>;
+    using R = Real<T>;
+    OrientedBoundingBox<T> box;
+    const int h = hull.size();
+    if (h == 0)
+    {
+        return box;
+    }
+    if (h <= 2)
+    {
+        const Point<T> p1 = hull[0];
+        const Point<T> p2 = hull[h - 1];
+        box.corners = {Point<R>(p1.x, p1.y), Point<R>(p2.x, p2.y), Point<R>(p2.x, p2.y), Point<R>(p1.x, p1.y)};
+        box.width = std::hypot(R(p2.x) - R(p1.x), R(p2.y) - R(p1.y));
+        return box;
+    }
+
+    // Signed length of vertex step (k, k + 1) along edge (i, i + 1), up to the length of the edge
+    const auto get_step = [&](int i, int k) noexcept {
+        const Point<T> p1 = hull[i];
+        const Point<T> p2 = hull[i + 1];
+        const Point<T> q1 = hull[k];
+        const Point<T> q2 = hull[k + 1];
+        return (A(p2.x) - A(p1.x)) * (A(q2.x) - A(q1.x)) + (A(p2.y) - A(p1.y)) * (A(q2.y) - A(q1.y));
+    };
+
+    int right = 1;
+    int top = 1;
+    int left = 1;
+    for (int i = 0; i < h; ++i)
+    {
+        advanceAntipodalVertex(hull, i, top);
+        while (get_step(i, right) > 0)
+        {
+            ++right;
+        }
+        if (i == 0)
+        {
+            left = top;
+        }
+        while (get_step(i, left) < 0)
+        {
+            ++left;
+        }
+
+        // Extents along the unit edge direction u and its inward normal, relative to the first edge vertex
+        const Point<T> origin = hull[i];
+        const Point<T> next = hull[i + 1];
+        const R edge_x = R(next.x) - R(origin.x);
+        const R edge_y = R(next.y) - R(origin.y);
+        const R length = std::hypot(edge_x, edge_y);
+        const R u_x = edge_x / length;
+        const R u_y = edge_y / length;
+        const auto get_extent = [&](int k) noexcept {
+            const Point<T> vertex = hull[k];
+            return (R(vertex.x) - R(origin.x)) * u_x + (R(vertex.y) - R(origin.y)) * u_y;
+        };
+        const R minimum = get_extent(left);
+        const R maximum = get_extent(right);
+        const R height = R(crossProduct<T>(origin, next, hull[top])) / length;
+        const R area = (maximum - minimum) * height;
+        if (i == 0 || area < box.area)
+        {
+            const Point<R> first(R(origin.x) + minimum * u_x, R(origin.y) + minimum * u_y);
+            const Point<R> second(R(origin.x) + maximum * u_x, R(origin.y) + maximum * u_y);
+            box.corners = {first, second, Point<R>(second.x - height * u_y, second.y + height * u_x),
+                           Point<R>(first.x - height * u_y, first.y + height * u_x)};
+            box.width = maximum - minimum;
+            box.height = height;
+            box.area = area;
+        }
+    }
+    return box;
+}
+
+/// @brief Returns the minimum-area rectangle enclosing the hull
+template <typename Points, typename T = PointCoordinate<Points>>
+OrientedBoundingBox<T> findMinimumAreaBoundingBox(const Points &points, const std::vector<int> &hull_indices) noexcept
+{
+    return findMinimumAreaBoundingBox(
+        CounterclockwiseHull<Points>(points, hull_indices.data(), static_cast<int>(hull_indices.size())));
+}
+
+/// @brief Returns diameter, minimum width and minimum-area bounding box of the hull
+template <typename Points, typename T = PointCoordinate<Points>>
+HullGeometry<T> findHullGeometry(const CounterclockwiseHull<Points> &hull) noexcept
+{
+    return {findHullDiameter(hull), findHullWidth(hull), findMinimumAreaBoundingBox(hull)};
+}
+
+/// @brief Constructs convex hulls of many small point sets in one call. Point set i is formed by points
+/// [offsets[i], offsets[i + 1]) of the flat point buffer (CSR layout), and its hull, as indices into the flat buffer,
+/// is stored in hull_indices[hull_offsets[i], hull_offsets[i + 1]). Hulls are built with Andrew's Monotone Chain over
+/// contiguous copies of the points, after sets of more than 32 points are reduced by the octagon interior point filter,
+/// and blocks of point sets are spread across threads, where 0 requests one thread per hardware thread. Unless
+/// geometries is null, geometries[i] receives the diameter, minimum width and minimum-area bounding box of hull i,
+/// computed right after the hull while it is in cache.
+template <typename T, typename Points>
+void constructConvexHulls(const Points &points, const std::vector<int> &offsets, std::vector<int> &hull_indices,
+                          std::vector<int> &hull_offsets, HullGeometry<T> *geometries,
+                          ConvexHullWorkspace<T> &workspace, Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                          ConvexHullReturnType return_type = ConvexHullReturnType::OPEN, int number_of_threads = 1)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, hull_indices, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, points.size());
+    hull_indices.clear();
+    hull_offsets.assign(1, 0);
+    if (orientation == Orientation::COLLINEAR)
+    {
+        std::cerr << "Orientation::COLLINEAR only supported internally. Returning empty hull." << std::endl;
+        return;
+    }
+
+    const int number_of_sets = offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
+    if (number_of_sets <= 0)
+    {
+        return;
+    }
+    hull_offsets.resize(number_of_sets + 1);
+
+    // Sets that are filtered use their own range of the index permutation
+    auto &indices = workspace.indices;
+    indices.resize(points.size());
+
+    // Split point sets into blocks, several per thread, so that uneven blocks stay balanced
+    number_of_threads = getNumberOfThreads(number_of_threads);
+    const int number_of_points = offsets[number_of_sets] - offsets[0];
+    const int number_of_blocks =
+        (number_of_threads == 1 || number_of_points < (1 << 15)) ? 1 : std::min(number_of_sets, 4 * number_of_threads);
+    auto &block_hulls = workspace.chunk_hulls;
+    block_hulls.resize(std::max<std::size_t>(block_hulls.size(), number_of_blocks));
+    workspace.blocks.resize(std::max<std::size_t>(workspace.blocks.size(), number_of_blocks));
+
+    // Filtering, sorting and scanning of the sets interleave within blocks, their time is counted as scan time
+    CONVEX_HULL_STAGE(SCAN);
+    runParallelTasks(getConvexHullThreadPool(workspace), number_of_blocks, number_of_threads, [&](int block_no) {
+        auto &block = workspace.blocks[block_no];
+        const int first_set = static_cast<int>(static_cast<long long>(number_of_sets) * block_no / number_of_blocks);
+        const int last_set =
+            static_cast<int>(static_cast<long long>(number_of_sets) * (block_no + 1) / number_of_blocks);
+        auto &block_hull = (number_of_blocks == 1) ? hull_indices : block_hulls[block_no];
+        block_hull.clear();
+        block_hull.reserve(2 * (offsets[last_set] - offsets[first_set]) + (last_set - first_set));
+
+        for (int set_no = first_set; set_no < last_set; ++set_no)
+        {
+            const auto offset = block_hull.size();
+            const int n = offsets[set_no + 1] - offsets[set_no];
+            if (n >= 3)
+            {
+                // Sets of up to 32 points are hulled directly from a copy on the stack, as filtering them costs more
+                // than it saves. Larger sets are copied after the filter has discarded most of their points.
+                IndexedPoint<T> small_set[32];
+                IndexedPoint<T> *set_points = small_set;
+                int m = n;
+                if (n <= 32)
+                {
+                    for (int i = 0; i < n; ++i)
+                    {
+                        const int index = offsets[set_no] + i;
+                        small_set[i] = {points[index].x, points[index].y, index};
+                    }
+                }
+                else
+                {
+                    int *const first = indices.data() + offsets[set_no];
+                    std::iota(first, first + n, offsets[set_no]);
+                    int *const last =
+                        filterInteriorPoints(points, first, first + n, ConvexHullFilter::OCTAGON, block.polygon);
+                    CONVEX_HULL_COUNT(number_of_filtered_points, first + n - last);
+                    block.points.clear();
+                    for (const int *it = first; it != last; ++it)
+                    {
+                        block.points.push_back({points[*it].x, points[*it].y, *it});
+                    }
+                    set_points = block.points.data();
+                    m = static_cast<int>(block.points.size());
+                }
+                sortIndexedPoints(set_points, set_points + m);
+                appendSortedMonotoneChainConvexHull(set_points, m, block_hull);
+
+                if (orientation == Orientation::CLOCKWISE)
+                {
+                    std::reverse(block_hull.begin() + offset, block_hull.end());
+                }
+                if (return_type == ConvexHullReturnType::ENCLOSED)
+                {
+                    block_hull.push_back(block_hull[offset]);
+                }
+            }
+            if (geometries)
+            {
+                geometries[set_no] = findHullGeometry(CounterclockwiseHull<Points>(
+                    points, block_hull.data() + offset, static_cast<int>(block_hull.size() - offset)));
+            }
+            hull_offsets[set_no + 1] = static_cast<int>(block_hull.size() - offset);
+        }
+    });
+
+    // Turn hull sizes into offsets, and concatenate block hulls
+    CONVEX_HULL_STAGE(MERGE);
+    for (int set_no = 0; set_no < number_of_sets; ++set_no)
+    {
+        hull_offsets[set_no + 1] += hull_offsets[set_no];
+    }
+    if (number_of_blocks > 1)
+    {
+        hull_indices.reserve(hull_offsets[number_of_sets]);
+        for (int block_no = 0; block_no < number_of_blocks; ++block_no)
+        {
+            hull_indices.insert(hull_indices.end(), block_hulls[block_no].begin(), block_hulls[block_no].end());
+        }
+    }
+}
+
+/// @brief Constructs convex hulls of many small point sets given in CSR layout in one call, using a workspace
+template <typename T, typename Points>
+void constructConvexHulls(const Points &points, const std::vector<int> &offsets, std::vector<int> &hull_indices,
+                          std::vector<int> &hull_offsets, ConvexHullWorkspace<T> &workspace,
+                          Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                          ConvexHullReturnType return_type = ConvexHullReturnType::OPEN, int number_of_threads = 1)
+{
+    constructConvexHulls(points, offsets, hull_indices, hull_offsets, static_cast<HullGeometry<T> *>(nullptr),
+                         workspace, orientation, return_type, number_of_threads);
+}
+
+/// @brief Constructs convex hulls of many small point sets given in CSR layout in one call, together with the
+/// geometry of every hull
+template <typename T, typename Points>
+void constructConvexHulls(const Points &points, const std::vector<int> &offsets, std::vector<int> &hull_indices,
+                          std::vector<int> &hull_offsets, std::vector<HullGeometry<T>> &geometries,
+                          ConvexHullWorkspace<T> &workspace, Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                          ConvexHullReturnType return_type = ConvexHullReturnType::OPEN, int number_of_threads = 1)
+{
+    geometries.assign(offsets.empty() ? 0 : offsets.size() - 1, HullGeometry<T>());
+    constructConvexHulls(points, offsets, hull_indices, hull_offsets, geometries.data(), workspace, orientation,
+                         return_type, number_of_threads);
+}
+
+/// @brief Constructs convex hulls of many small point sets given in CSR layout in one call
+template <typename Points, typename T = PointCoordinate<Points>>
+void constructConvexHulls(const Points &points, const std::vector<int> &offsets, std::vector<int> &hull_indices,
+                          std::vector<int> &hull_offsets, Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                          ConvexHullReturnType return_type = ConvexHullReturnType::OPEN, int number_of_threads = 1)
+{
+    ConvexHullWorkspace<T> workspace;
+    constructConvexHulls(points, offsets, hull_indices, hull_offsets, workspace, orientation, return_type,
+                         number_of_threads);
+}
+
+/// @brief Constructs convex hulls of many small point sets given in CSR layout in one call, together with the
+/// geometry of every hull
+template <typename Points, typename T = PointCoordinate<Points>>
+void constructConvexHulls(const Points &points, const std::vector<int> &offsets, std::vector<int> &hull_indices,
+                          std::vector<int> &hull_offsets, std::vector<HullGeometry<T>> &geometries,
+                          Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                          ConvexHullReturnType return_type = ConvexHullReturnType::OPEN, int number_of_threads = 1)
+{
+    ConvexHullWorkspace<T> workspace;
+    constructConvexHulls(points, offsets, hull_indices, hull_offsets, geometries, workspace, orientation, return_type,
+                         number_of_threads);
+}
+
+/// @brief Merges hulls given in CSR layout, hull i being hull_indices[hull_offsets[i], hull_offsets[i + 1]) as
+/// produced by constructConvexHulls, into the hull of the union of their points, stored in merged_hull_indices. Hulls
+/// hold indices into points, which are kept in the result, and may have either orientation and be open or enclosed.
+/// Each hull is split into its two sides, which are already ordered, so the vertices are merged in O(H log k) time for
+/// H vertices of k hulls instead of being sorted again.
+template <typename T, typename Points>
+void mergeConvexHulls(const Points &points, const std::vector<int> &hull_indices, const std::vector<int> &hull_offsets,
+                      std::vector<int> &merged_hull_indices, ConvexHullWorkspace<T> &workspace,
+                      Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                      ConvexHullReturnType return_type = ConvexHullReturnType::OPEN)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, merged_hull_indices, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, points.size());
+    merged_hull_indices.clear();
+    if (orientation == Orientation::COLLINEAR)
+    {
+        std::cerr << "Orientation::COLLINEAR only supported internally. Returning empty hull." << std::endl;
+        return;
+    }
+
+    CONVEX_HULL_STAGE(MERGE);
+    const int number_of_hulls = hull_offsets.empty() ? 0 : static_cast<int>(hull_offsets.size()) - 1;
+    for (int hull_no = 0; hull_no < number_of_hulls; ++hull_no)
+    {
+        appendConvexHullMergeRuns(points, hull_indices.data() + hull_offsets[hull_no],
+                                  hull_offsets[hull_no + 1] - hull_offsets[hull_no], workspace.merge_buffers);
+    }
+    workspace.radix_items.resize(2 * workspace.merge_buffers.vertices.size());
+    appendMergedConvexHull(workspace.merge_buffers, merged_hull_indices, workspace.radix_items.data());
+
+    applyOrientationAndReturnType(merged_hull_indices, orientation, return_type);
+}
+
+/// @brief Merges hulls, each holding indices into points, into the hull of the union of their points
+template <typename T, typename Points>
+void mergeConvexHulls(const Points &points, const std::vector<std::vector<int>> &hulls,
+                      std::vector<int> &merged_hull_indices, ConvexHullWorkspace<T> &workspace,
+                      Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                      ConvexHullReturnType return_type = ConvexHullReturnType::OPEN)
+{
+    CONVEX_HULL_STATS_SCOPE(workspace, merged_hull_indices, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, points.size());
+    merged_hull_indices.clear();
+    if (orientation == Orientation::COLLINEAR)
+    {
+        std::cerr << "Orientation::COLLINEAR only supported internally. Returning empty hull." << std::endl;
+        return;
+    }
+
+    CONVEX_HULL_STAGE(MERGE);
+    for (const auto &hull : hulls)
+    {
+        appendConvexHullMergeRuns(points, hull.data(), static_cast<int>(hull.size()), workspace.merge_buffers);
+    }
+    workspace.radix_items.resize(2 * workspace.merge_buffers.vertices.size());
+    appendMergedConvexHull(workspace.merge_buffers, merged_hull_indices, workspace.radix_items.data());
+
+    applyOrientationAndReturnType(merged_hull_indices, orientation, return_type);
+}
+
+/// @brief Merges hulls given in CSR layout into the hull of the union of their points
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> mergeConvexHulls(const Points &points, const std::vector<int> &hull_indices,
+                                  const std::vector<int> &hull_offsets,
+                                  Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                                  ConvexHullReturnType return_type = ConvexHullReturnType::OPEN)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> merged_hull_indices;
+    mergeConvexHulls(points, hull_indices, hull_offsets, merged_hull_indices, workspace, orientation, return_type);
+    return merged_hull_indices;
+}
+
+/// @brief Merges hulls, each holding indices into points, into the hull of the union of their points
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> mergeConvexHulls(const Points &points, const std::vector<std::vector<int>> &hulls,
+                                  Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                                  ConvexHullReturnType return_type = ConvexHullReturnType::OPEN)
+{
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> merged_hull_indices;
+    mergeConvexHulls(points, hulls, merged_hull_indices, workspace, orientation, return_type);
+    return merged_hull_indices;
+}
+
+/// @brief Hull of the union of many cached hulls, such as those of map tiles, kept as a tree in which every node
+/// stores the hull of its children, merged as in mergeConvexHulls. Replacing the hull of one leaf merges only the nodes
+/// on its path to the root, so the hull of the union is updated in O(log_f(k)) merges of f hulls for k leaves and
+/// fan-out f. With a fan-out of 4 and leaves in Z-order, the nodes are the cells of a quadtree. Hulls hold indices
+/// into the points passed with every update, which must keep the indices of all cached hulls valid.
+template <typename T> class ConvexHullMergeTree
+{
+  public:
+    explicit ConvexHullMergeTree(int number_of_leaves = 0, int fan_out = 4) : fan_out_(std::max(fan_out, 2))
+    {
+        // Level 0 holds the leaves, and every level above holds one node per fan_out nodes below, up to the root
+        levels_.emplace_back(std::max(number_of_leaves, 0));
+        do
+        {
+            const std::size_t size = levels_.back().size();
+            levels_.emplace_back(std::max<std::size_t>((size + fan_out_ - 1) / fan_out_, 1));
+        } while (levels_.back().size() > 1);
+    }
+
+    /// @brief Replaces the hull of a leaf, holding indices into points in either orientation, open or enclosed, and
+    /// merges the hulls of its ancestors. Returns false, leaving the tree unchanged, if the leaf is out of range.
+    template <typename Points> bool setLeafHull(const Points &points, int leaf_no, const std::vector<int> &hull_indices)
+    {
+        if (leaf_no < 0 || leaf_no >= getNumberOfLeaves())
+        {
+            return false;
+        }
+
+        levels_[0][leaf_no].assign(hull_indices.begin(), hull_indices.end());
+        for (int level = 1, node_no = leaf_no / fan_out_; level < getNumberOfLevels(); ++level, node_no /= fan_out_)
+        {
+            mergeNode(points, level, node_no);
+        }
+        return true;
+    }
+
+    /// @brief Replaces the hulls of all leaves, given in CSR layout as produced by constructConvexHulls, and merges
+    /// every node once, bottom-up. Returns false, leaving the tree unchanged, if the number of hulls differs from the
+    /// number of leaves.
+    template <typename Points>
+    bool setLeafHulls(const Points &points, const std::vector<int> &hull_indices, const std::vector<int> &hull_offsets)
+    {
+        const int number_of_hulls = hull_offsets.empty() ? 0 : static_cast<int>(hull_offsets.size()) - 1;
+        if (number_of_hulls != getNumberOfLeaves())
+        {
+            return false;
+        }
+
+        for (int leaf_no = 0; leaf_no < number_of_hulls; ++leaf_no)
+        {
+            levels_[0][leaf_no].assign(hull_indices.begin() + hull_offsets[leaf_no],
+                                       hull_indices.begin() + hull_offsets[leaf_no + 1]);
+        }
+        for (int level = 1; level < getNumberOfLevels(); ++level)
+        {
+            for (int node_no = 0; node_no < static_cast<int>(levels_[level].size()); ++node_no)
+            {
+                mergeNode(points, level, node_no);
+            }
+        }
+        return true;
+    }
+
+    int getNumberOfLeaves() const noexcept
+    {
+        return static_cast<int>(levels_[0].size());
+    }
+
+    /// @brief Returns number of levels, including the leaves and the root
+    int getNumberOfLevels() const noexcept
+    {
+        return static_cast<int>(levels_.size());
+    }
+
+    /// @brief Returns the hull stored at a node, where level 0 holds the leaf hulls as given and nodes of higher levels
+    /// hold counterclockwise hulls starting from their lowest vertex
+    const std::vector<int> &getNodeHull(int level, int node_no) const
+    {
+        return levels_[level][node_no];
+    }
+
+    /// @brief Stores the hull of the union of all leaf hulls
+    void getHullIndices(std::vector<int> &hull_indices, Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                        ConvexHullReturnType return_type = ConvexHullReturnType::OPEN) const
+    {
+        hull_indices.assign(levels_.back()[0].begin(), levels_.back()[0].end());
+        applyOrientationAndReturnType(hull_indices, orientation, return_type);
+    }
+
+    std::vector<int> getHullIndices(Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                                    ConvexHullReturnType return_type = ConvexHullReturnType::OPEN) const
+    {
+        std::vector<int> hull_indices;
+        getHullIndices(hull_indices, orientation, return_type);
+        return hull_indices;
+    }
+
+  private:
+    /// @brief Replaces the hull of a node by the merged hulls of its children
+    template <typename Points> void mergeNode(const Points &points, int level, int node_no)
+    {
+        const auto &children = levels_[level - 1];
+        const int first_child = node_no * fan_out_;
+        const int last_child = std::min(first_child + fan_out_, static_cast<int>(children.size()));
+        for (int child_no = first_child; child_no < last_child; ++child_no)
+        {
+            appendConvexHullMergeRuns(points, children[child_no].data(), static_cast<int>(children[child_no].size()),
+                                      buffers_);
+        }
+
+        auto &hull = levels_[level][node_no];
+        hull.clear();
+        appendMergedConvexHull(buffers_, hull);
+    }
+
+    int fan_out_;
+    std::vector<std::vector<std::vector<int>>> levels_;
+    ConvexHullMergeBuffers<T> buffers_;
+};
+
+/// @brief Allocator aligning storage to cache lines, so that arrays read by batched queries start on a line of their
+/// own
+template <typename T> struct CacheAlignedAllocator
+{
+    using value_type = T;
+    static constexpr std::size_t alignment = 64;
+
+    CacheAlignedAllocator() = default;
+
+    template <typename U> CacheAlignedAllocator(const CacheAlignedAllocator<U> &) noexcept
+    {
+    }
+
+    T *allocate(std::size_t n)
+    {
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(alignment)));
+    }
+
+    void deallocate(T *ptr, std::size_t) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t(alignment));
+    }
+
+    template <typename U> bool operator==(const CacheAlignedAllocator<U> &) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U> bool operator!=(const CacheAlignedAllocator<U> &) const noexcept
+    {
+        return false;
+    }
+};
+
+/// @brief Convex polygon built from a hull for repeated queries. Vertices are copied into cache-line aligned coordinate
+/// arrays in counterclockwise order, and containment, tangent and extreme vertex queries take O(log h). Queries return
+/// positions of vertices within the polygon, which getIndex maps back to indices of the input points.
+template <typename T> class ConvexPolygon
+{
+  public:
+    ConvexPolygon() = default;
+
+    /// @brief Builds polygon from points and hull indices returned by constructConvexHull, of either orientation and
+    /// return type
+    template <typename Points> ConvexPolygon(const Points &points, const std::vector<int> &hull_indices)
+    {
+        int h = static_cast<int>(hull_indices.size());
+        if (h > 1 && hull_indices[0] == hull_indices[h - 1])
+        {
+            --h;
+        }
+        indices_.assign(hull_indices.begin(), hull_indices.begin() + h);
+        if (h > 2 && getOrientationSign(points[indices_[0]], points[indices_[1]], points[indices_[2]]) < 0)
+        {
+            std::reverse(indices_.begin() + 1, indices_.end());
+        }
+
+        if (h == 0)
+        {
+            return;
+        }
+
+        // The first vertex is repeated after the last one, so that edges never wrap around
+        x_.resize(h + 1);
+        y_.resize(h + 1);
+        for (int i = 0; i <= h; ++i)
+        {
+            const Point<T> vertex = points[indices_[i % h]];
+            x_[i] = vertex.x;
+            y_[i] = vertex.y;
+        }
+    }
+
+    int size() const noexcept
+    {
+        return static_cast<int>(indices_.size());
+    }
+
+    Point<T> getVertex(int i) const noexcept
+    {
+        return Point<T>(x_[i], y_[i]);
+    }
+
+    /// @brief Returns index of vertex i into the points the polygon was built from
+    int getIndex(int i) const noexcept
+    {
+        return indices_[i];
+    }
+
+    const std::vector<int> &getIndices() const noexcept
+    {
+        return indices_;
+    }
+
+    /// @brief Returns true if point lies inside the polygon or on its boundary, in O(log h)
+    bool contains(const Point<T> &point) const noexcept
+    {
+        return isInsideConvexPolygon(x_.data(), y_.data(), size(), point);
+    }
+
+    /// @brief Tests containment of every point, storing 1 in is_inside for points inside the polygon or on its
+    /// boundary and 0 otherwise
+    template <typename Points> void contains(const Points &points, std::vector<std::uint8_t> &is_inside) const
+    {
+        const int n = static_cast<int>(points.size());
+        is_inside.resize(n);
+        for (int i = 0; i < n; ++i)
+        {
+            is_inside[i] = contains(points[i]);
+        }
+    }
+
+    /// @brief Tests containment of every point as above, several points at a time with SIMD instructions
+    void contains(const PointArray<T> &points, std::vector<std::uint8_t> &is_inside) const
+    {
+        const int n = static_cast<int>(points.size());
+        is_inside.resize(n);
+        testPointsInConvexPolygon(x_.data(), y_.data(), size(), points.x.data(), points.y.data(), n,
+                                  is_inside.data());
+    }
+
+    /// @brief Finds the vertices tangent from a point outside the polygon in O(log h): the polygon lies to the left of
+    /// the ray from point through right_tangent and to the right of the ray through left_tangent, and the farthest
+    /// vertex is taken if several are collinear with point. Returns false if point is inside or on the boundary.
+    bool findTangents(const Point<T> &point, int &right_tangent, int &left_tangent) const noexcept
+    {
+        const int h = size();
+        if (h == 0 || contains(point))
+        {
+            return false;
+        }
+
+        right_tangent = findConvexPolygonTangent([&](int i) noexcept { return getVertex(i); }, h, point);
+
+        // Reflecting across the line y = x and reversing the vertex order keeps the polygon counterclockwise and
+        // turns the left tangent into a right one
+        const int reflected_tangent = findConvexPolygonTangent(
+            [&](int i) noexcept {
+                const int j = (h - i) % h;
+                return Point<T>(y_[j], x_[j]);
+            },
+            h, Point<T>(point.y, point.x));
+        left_tangent = (h - reflected_tangent) % h;
+        return true;
+    }
+
+    /// @brief Returns the vertex farthest in the given direction in O(log h), the first one counterclockwise if an
+    /// edge is perpendicular to the direction, or -1 for an empty polygon. Dot products of floating-point coordinates
+    /// are rounded.
+    int findExtremeVertex(const Point<T> &direction) const noexcept
+    {
+        const int h = size();
+        if (h == 0)
+        {
+            return -1;
+        }
+
+        using A = Accumulator<T>;
+        const auto dot = [&](int i) noexcept { return A(direction.x) * A(x_[i]) + A(direction.y) * A(y_[i]); };
+        const auto is_above = [&](int i, int j) noexcept { return dot(i) > dot(j); };
+
+        // Binary search over the chain [a, b] for a vertex above both neighbours, selecting the subchain by whether
+        // its first edge and the middle edge go up or down in the direction
+        int c = 0;
+        if (h > 2 && (is_above(1, 0) || is_above(h - 1, 0)))
+        {
+            int a = 0;
+            int b = h;
+            while (b - a > 1)
+            {
+                c = (a + b) / 2;
+                const bool up_c = is_above(c + 1, c);
+                if (!up_c && !is_above(c - 1, c))
+                {
+                    break;
+                }
+                if (is_above(a + 1, a))
+                {
+                    if (!up_c || is_above(a, c))
+                    {
+                        b = c;
+                    }
+                    else
+                    {
+                        a = c;
+                    }
+                }
+                else
+                {
+                    if (up_c || !is_above(c, a))
+                    {
+                        a = c;
+                    }
+                    else
+                    {
+                        b = c;
+                    }
+                }
+                c = a;
+            }
+        }
+
+        // Walk to the maximum, which resolves small polygons and equal dot products, then to the first vertex of a
+        // perpendicular edge
+        for (int step = 0; step < h; ++step)
+        {
+            if (is_above((c + 1) % h, c))
+            {
+                c = (c + 1) % h;
+            }
+            else if (is_above((c + h - 1) % h, c))
+            {
+                c = (c + h - 1) % h;
+            }
+            else
+            {
+                break;
+            }
+        }
+        if (h > 1 && dot((c + h - 1) % h) == dot(c))
+        {
+            c = (c + h - 1) % h;
+        }
+        return c;
+    }
+
+  private:
+    std::vector<int> indices_;
+    std::vector<T, CacheAlignedAllocator<T>> x_, y_;
+};
+
+/// @brief Convex chain of points with strictly increasing x kept in a balanced search tree, forming either the lower
+/// or the upper hull of all points inserted into it. Changes can be logged, so that insertions can be rolled back.
+template <typename T> class ConvexChain
+{
+  public:
+    static_assert(std::is_signed<T>::value, "ConvexChain can only be templated with signed types");
+
+    /// @brief Chain vertex stored under its x-coordinate
+    struct Vertex
+    {
+        T y;
+        int index;
+    };
+
+    explicit ConvexChain(bool is_upper) noexcept : is_upper_(is_upper)
+    {
+    }
+
+    const std::map<T, Vertex> &getVertices() const noexcept
+    {
+        return vertices_;
+    }
+
+    /// @brief Returns true if point lies within the x-range of the chain, on its inner side or on the chain itself
+    bool contains(const Point<T> &point) const
+    {
+        const auto next = vertices_.lower_bound(point.x);
+        if (next == vertices_.end())
+        {
+            return false;
+        }
+        if (next->first == point.x)
+        {
+            return is_upper_ ? (point.y <= next->second.y) : (point.y >= next->second.y);
+        }
+        if (next == vertices_.begin())
+        {
+            return false;
+        }
+        return getInwardOrientation(getPoint(std::prev(next)), getPoint(next), point) >= 0;
+    }
+
+    /// @brief Inserts point into the chain in amortized O(log h), removing vertices that stop being convex. Returns
+    /// false without changes if point is contained by the chain.
+    bool insert(const Point<T> &point, int index)
+    {
+        if (contains(point))
+        {
+            return false;
+        }
+
+        auto it = vertices_.find(point.x);
+        if (it != vertices_.end())
+        {
+            logChange(it->first, true, it->second);
+            it->second = {point.y, index};
+        }
+        else
+        {
+            logChange(point.x, false, {point.y, index});
+            it = vertices_.emplace(point.x, Vertex{point.y, index}).first;
+        }
+
+        // Remove vertices to the right that are no longer convex
+        while (true)
+        {
+            const auto next = std::next(it);
+            if (next == vertices_.end() || std::next(next) == vertices_.end() ||
+                getInwardOrientation(getPoint(it), getPoint(std::next(next)), getPoint(next)) < 0)
+            {
+                break;
+            }
+            logChange(next->first, true, next->second);
+            vertices_.erase(next);
+        }
+
+        // Remove vertices to the left that are no longer convex
+        while (it != vertices_.begin())
+        {
+            const auto prev = std::prev(it);
+            if (prev == vertices_.begin() ||
+                getInwardOrientation(getPoint(std::prev(prev)), getPoint(it), getPoint(prev)) < 0)
+            {
+                break;
+            }
+            logChange(prev->first, true, prev->second);
+            vertices_.erase(prev);
+        }
+
+        return true;
+    }
+
+    /// @brief Enables or disables logging of changes made by insertions
+    void setLogging(bool is_logging) noexcept
+    {
+        is_logging_ = is_logging;
+    }
+
+    /// @brief Returns number of logged changes, to be used as a rollback checkpoint
+    std::size_t getCheckpoint() const noexcept
+    {
+        return changes_.size();
+    }
+
+    /// @brief Reverts all changes logged after the checkpoint
+    void rollback(std::size_t checkpoint)
+    {
+        while (changes_.size() > checkpoint)
+        {
+            const auto &change = changes_.back();
+            if (change.existed)
+            {
+                vertices_[change.x] = change.vertex;
+            }
+            else
+            {
+                vertices_.erase(change.x);
+            }
+            changes_.pop_back();
+        }
+    }
+
+    void clear() noexcept
+    {
+        vertices_.clear();
+        changes_.clear();
+    }
+
+  private:
+    /// @brief Logged change that restores vertex at x (or removes it if it did not exist)
+    struct Change
+    {
+        T x;
+        bool existed;
+        Vertex vertex;
+    };
+
+    static Point<T> getPoint(typename std::map<T, Vertex>::const_iterator it) noexcept
+    {
+        return Point<T>(it->first, it->second.y);
+    }
+
+    int getInwardOrientation(const Point<T> &p1, const Point<T> &p2, const Point<T> &p3) const noexcept
+    {
+        const int orientation = getOrientationSign(p1, p2, p3);
+        return is_upper_ ? -orientation : orientation;
+    }
+
+    void logChange(T x, bool existed, const Vertex &vertex)
+    {
+        if (is_logging_)
+        {
+            changes_.push_back({x, existed, vertex});
+        }
+    }
+
+    bool is_upper_;
+    bool is_logging_ = false;
+    std::map<T, Vertex> vertices_;
+    std::vector<Change> changes_;
+};
+
+/// @brief Convex hull maintained under streaming point insertion. Insertion takes amortized O(log h), points inside
+/// the hull are rejected in O(log h), and the current hull is available without recomputation.
+template <typename T> class DynamicConvexHull
+{
+  public:
+    /// @brief Rollback checkpoint of both chains
+    struct Checkpoint
+    {
+        std::size_t lower, upper;
+    };
+
+    DynamicConvexHull() : lower_(false), upper_(true)
+    {
+    }
+
+    /// @brief Inserts point with the given index. Returns true if the point became a hull vertex.
+    bool insert(const Point<T> &point, int index)
+    {
+        const bool is_lower_changed = lower_.insert(point, index);
+        const bool is_upper_changed = upper_.insert(point, index);
+        return is_lower_changed || is_upper_changed;
+    }
+
+    /// @brief Returns true if point lies inside or on the boundary of the hull
+    bool contains(const Point<T> &point) const
+    {
+        return lower_.contains(point) && upper_.contains(point);
+    }
+
+    bool empty() const noexcept
+    {
+        return lower_.getVertices().empty();
+    }
+
+    /// @brief Stores current hull indices, counterclockwise starting from the lowest of the leftmost points
+    void getHullIndices(std::vector<int> &hull_indices, Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                        ConvexHullReturnType return_type = ConvexHullReturnType::OPEN) const
+    {
+        hull_indices.clear();
+        const auto &lower = lower_.getVertices();
+        const auto &upper = upper_.getVertices();
+        for (const auto &vertex : lower)
+        {
+            hull_indices.push_back(vertex.second.index);
+        }
+
+        // Upper chain shares its endpoints with the lower one unless the hull has vertical edges
+        const std::size_t lower_size = hull_indices.size();
+        for (auto it = upper.rbegin(); it != upper.rend(); ++it)
+        {
+            const int index = it->second.index;
+            if (index != hull_indices[lower_size - 1] && index != hull_indices[0])
+            {
+                hull_indices.push_back(index);
+            }
+        }
+
+        applyOrientationAndReturnType(hull_indices, orientation, return_type);
     }
-    default: {
-        return {};
+
+    std::vector<int> getHullIndices(Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                                    ConvexHullReturnType return_type = ConvexHullReturnType::OPEN) const
+    {
+        std::vector<int> hull_indices;
+        if (!empty())
+        {
+            getHullIndices(hull_indices, orientation, return_type);
+        }
+        return hull_indices;
+    }
+
+    /// @brief Calls function(point, index) for every hull vertex of both chains; shared endpoints are visited twice
+    template <typename Function> void forEachChainVertex(Function &&function) const
+    {
+        for (const auto *chain : {&lower_, &upper_})
+        {
+            for (const auto &vertex : chain->getVertices())
+            {
+                function(Point<T>(vertex.first, vertex.second.y), vertex.second.index);
+            }
+        }
+    }
+
+    /// @brief Enables or disables logging of changes, which is required for rollback
+    void setLogging(bool is_logging) noexcept
+    {
+        lower_.setLogging(is_logging);
+        upper_.setLogging(is_logging);
+    }
+
+    Checkpoint getCheckpoint() const noexcept
+    {
+        return {lower_.getCheckpoint(), upper_.getCheckpoint()};
+    }
+
+    /// @brief Reverts all insertions made after the checkpoint
+    void rollback(const Checkpoint &checkpoint)
+    {
+        lower_.rollback(checkpoint.lower);
+        upper_.rollback(checkpoint.upper);
+    }
+
+    void clear() noexcept
+    {
+        lower_.clear();
+        upper_.clear();
+    }
+
+  private:
+    ConvexChain<T> lower_;
+    ConvexChain<T> upper_;
+};
+
+/// @brief Convex hull of a sliding window over a point stream, supporting insertion of new points and removal of the
+/// oldest one in amortized O(log n). The window is a queue made of two stacks of hulls with rollback, and the hull of
+/// the whole window is merged from both stacks lazily, in O(h log h), when it is queried after a change.
+template <typename T> class SlidingWindowConvexHull
+{
+  public:
+    SlidingWindowConvexHull()
+    {
+        front_.setLogging(true);
+    }
+
+    /// @brief Appends the newest point with the given index to the window
+    void push(const Point<T> &point, int index)
+    {
+        back_entries_.push_back({point, index, {}});
+        back_.insert(point, index);
+        is_merged_ = false;
+    }
+
+    /// @brief Removes the oldest point from the window
+    void pop()
+    {
+        if (front_entries_.empty())
+        {
+            // Move points to the front stack, newest first, so that the oldest point is on top
+            front_.clear();
+            for (auto it = back_entries_.rbegin(); it != back_entries_.rend(); ++it)
+            {
+                const auto checkpoint = front_.getCheckpoint();
+                front_.insert(it->point, it->index);
+                front_entries_.push_back({it->point, it->index, checkpoint});
+            }
+            back_.clear();
+            back_entries_.clear();
+        }
+
+        if (!front_entries_.empty())
+        {
+            front_.rollback(front_entries_.back().checkpoint);
+            front_entries_.pop_back();
+            is_merged_ = false;
+        }
+    }
+
+    /// @brief Returns number of points in the window
+    std::size_t size() const noexcept
+    {
+        return front_entries_.size() + back_entries_.size();
+    }
+
+    /// @brief Returns true if point lies inside or on the boundary of the hull of the window
+    bool contains(const Point<T> &point) const
+    {
+        return getMergedHull().contains(point);
+    }
+
+    /// @brief Stores hull indices of the window, counterclockwise starting from the lowest of the leftmost points
+    void getHullIndices(std::vector<int> &hull_indices, Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                        ConvexHullReturnType return_type = ConvexHullReturnType::OPEN) const
+    {
+        hull_indices.clear();
+        if (size() != 0)
+        {
+            getMergedHull().getHullIndices(hull_indices, orientation, return_type);
+        }
+    }
+
+    std::vector<int> getHullIndices(Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                                    ConvexHullReturnType return_type = ConvexHullReturnType::OPEN) const
+    {
+        std::vector<int> hull_indices;
+        getHullIndices(hull_indices, orientation, return_type);
+        return hull_indices;
+    }
+
+  private:
+    /// @brief Window point, and the front stack checkpoint taken before its insertion
+    struct Entry
+    {
+        Point<T> point;
+        int index;
+        typename DynamicConvexHull<T>::Checkpoint checkpoint;
+    };
+
+    /// @brief Returns hull of the window, as the hull of the vertices of both stack hulls
+    const DynamicConvexHull<T> &getMergedHull() const
+    {
+        if (!is_merged_)
+        {
+            merged_.clear();
+            const auto insert = [this](const Point<T> &point, int index) { merged_.insert(point, index); };
+            front_.forEachChainVertex(insert);
+            back_.forEachChainVertex(insert);
+            is_merged_ = true;
+        }
+        return merged_;
+    }
+
+    DynamicConvexHull<T> front_;
+    DynamicConvexHull<T> back_;
+    std::vector<Entry> front_entries_;
+    std::vector<Entry> back_entries_;
+    mutable DynamicConvexHull<T> merged_;
+    mutable bool is_merged_ = true;
+};
+
+/// @brief Convex hull of a point stream that does not fit in memory. Each chunk of points is reduced to its hull,
+/// which is merged with the running hull, as the hull of a union of point sets is the hull of the union of their
+/// hulls, so memory use is O(h + chunk). Hull vertices are identified by their 64-bit index in the stream. Chunks
+/// can be read from a flat binary file, or passed as any point container, such as a PointView over a memory-mapped
+/// file.
+template <typename T> class StreamingConvexHull
+{
+  public:
+    explicit StreamingConvexHull(ConvexHullAlgorithm algorithm = ConvexHullAlgorithm::QUICKHULL,
+                                 ConvexHullFilter filter = ConvexHullFilter::OCTAGON)
+        : algorithm_(algorithm), filter_(filter)
+    {
+    }
+
+    /// @brief Appends the next chunk of points to the stream, whose indices continue from the previous chunks
+    template <typename Points> void insert(const Points &points)
+    {
+        insert(points, number_of_points_);
+    }
+
+    /// @brief Appends the points of a flat binary file of interleaved x and y coordinates of type T to the stream,
+    /// read in chunks of chunk_size points. Each of number_of_threads threads reads a contiguous part of the file,
+    /// where 0 requests one thread per hardware thread. Trailing bytes that do not form a whole point are ignored.
+    /// Returns false, leaving the hull unchanged, if the file cannot be read.
+    bool insertFile(const std::string &path, std::size_t chunk_size = std::size_t(1) << 20, int number_of_threads = 1)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            return false;
+        }
+        constexpr auto point_size = static_cast<std::int64_t>(2 * sizeof(T));
+        const std::int64_t number_of_points = static_cast<std::int64_t>(file.tellg()) / point_size;
+        const auto points_per_chunk = static_cast<std::int64_t>(std::max<std::size_t>(chunk_size, 1));
+        const auto number_of_chunks = (number_of_points + points_per_chunk - 1) / points_per_chunk;
+        const int number_of_parts =
+            static_cast<int>(std::clamp<std::int64_t>(number_of_chunks, 1, getNumberOfThreads(number_of_threads)));
+
+        // Every part keeps its own running hull, merged in file order below, so that duplicates resolve as in a
+        // serial read
+        std::vector<StreamingConvexHull> parts(number_of_parts, StreamingConvexHull(algorithm_, filter_));
+        std::atomic<bool> is_read{true};
+        runParallelTasks(getConvexHullThreadPool(workspace_), number_of_parts, number_of_parts, [&](int part_no) {
+            const std::int64_t first = number_of_chunks * part_no / number_of_parts * points_per_chunk;
+            const std::int64_t last =
+                std::min(number_of_chunks * (part_no + 1) / number_of_parts * points_per_chunk, number_of_points);
+            std::ifstream part_file(path, std::ios::binary);
+            part_file.seekg(first * point_size);
+            std::vector<T> coordinates;
+            for (std::int64_t chunk_first = first; chunk_first < last && is_read; chunk_first += points_per_chunk)
+            {
+                const std::int64_t count = std::min(points_per_chunk, last - chunk_first);
+                coordinates.resize(2 * count);
+                if (!part_file.read(reinterpret_cast<char *>(coordinates.data()), count * point_size))
+                {
+                    is_read = false;
+                    return;
+                }
+                parts[part_no].insert(PointView<T>(coordinates.data(), coordinates.data() + 1,
+                                                   static_cast<std::size_t>(count), point_size),
+                                      number_of_points_ + chunk_first);
+            }
+        });
+        if (!is_read)
+        {
+            return false;
+        }
+
+        for (const auto &part : parts)
+        {
+            const int first_candidate = static_cast<int>(hull_points_.size());
+            hull_points_.insert(hull_points_.end(), part.hull_points_.begin(), part.hull_points_.end());
+            hull_indices_.insert(hull_indices_.end(), part.hull_indices_.begin(), part.hull_indices_.end());
+            updateHull(first_candidate);
+        }
+        number_of_points_ += number_of_points;
+        return true;
+    }
+
+    /// @brief Returns number of points consumed from the stream
+    std::int64_t size() const noexcept
+    {
+        return number_of_points_;
+    }
+
+    /// @brief Returns hull vertices, counterclockwise starting from the lowest point
+    const std::vector<Point<T>> &getHullPoints() const noexcept
+    {
+        return hull_points_;
+    }
+
+    /// @brief Stores stream indices of hull vertices, starting from the lowest point. The hull is empty for fewer
+    /// than 3 points, as in constructConvexHull.
+    void getHullIndices(std::vector<std::int64_t> &hull_indices,
+                        Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                        ConvexHullReturnType return_type = ConvexHullReturnType::OPEN) const
+    {
+        hull_indices.clear();
+        if (number_of_points_ < 3)
+        {
+            return;
+        }
+        hull_indices.assign(hull_indices_.begin(), hull_indices_.end());
+        applyOrientationAndReturnType(hull_indices, orientation, return_type);
+    }
+
+    std::vector<std::int64_t> getHullIndices(Orientation orientation = Orientation::COUNTERCLOCKWISE,
+                                             ConvexHullReturnType return_type = ConvexHullReturnType::OPEN) const
+    {
+        std::vector<std::int64_t> hull_indices;
+        getHullIndices(hull_indices, orientation, return_type);
+        return hull_indices;
+    }
+
+    void clear() noexcept
+    {
+        hull_points_.clear();
+        hull_indices_.clear();
+        number_of_points_ = 0;
+    }
+
+  private:
+    /// @brief Merges the hull of points, whose stream indices start at first_index, into the running hull
+    template <typename Points> void insert(const Points &points, std::int64_t first_index)
+    {
+        const int n = static_cast<int>(points.size());
+        const int first_candidate = static_cast<int>(hull_points_.size());
+        if (n < 3)
+        {
+            // Chunks too small for a hull are merged as they are
+            for (int i = 0; i < n; ++i)
+            {
+                hull_points_.push_back(points[i]);
+                hull_indices_.push_back(first_index + i);
+            }
+        }
+        else
+        {
+            constructConvexHull(points, chunk_hull_, workspace_, algorithm_, Orientation::COUNTERCLOCKWISE,
+                                ConvexHullReturnType::OPEN, filter_);
+            for (const int index : chunk_hull_)
+            {
+                hull_points_.push_back(points[index]);
+                hull_indices_.push_back(first_index + index);
+            }
+        }
+        updateHull(first_candidate);
+        number_of_points_ = std::max(number_of_points_, first_index + n);
+    }
+
+    /// @brief Reduces the running hull vertices followed by newly appended candidates, starting at first_candidate, to
+    /// their hull. Candidates come later in the stream, so the buffer stays in stream order and ties between duplicates
+    /// favour earlier ones. Both are convex, so their vertices are merged into order rather than sorted.
+    void updateHull(int first_candidate)
+    {
+        const int n = static_cast<int>(hull_points_.size());
+        auto &indices = workspace_.indices;
+        indices.resize(n);
+        std::iota(indices.begin(), indices.end(), 0);
+        appendConvexHullMergeRuns(hull_points_, indices.data(), first_candidate, merge_buffers_);
+        appendConvexHullMergeRuns(hull_points_, indices.data() + first_candidate, n - first_candidate, merge_buffers_);
+        chunk_hull_.clear();
+        appendMergedConvexHull(merge_buffers_, chunk_hull_);
+
+        merged_points_.clear();
+        merged_indices_.clear();
+        for (const int index : chunk_hull_)
+        {
+            merged_points_.push_back(hull_points_[index]);
+            merged_indices_.push_back(hull_indices_[index]);
+        }
+        std::swap(hull_points_, merged_points_);
+        std::swap(hull_indices_, merged_indices_);
+    }
+
+    ConvexHullAlgorithm algorithm_;
+    ConvexHullFilter filter_;
+    std::int64_t number_of_points_ = 0;
+    std::vector<Point<T>> hull_points_;
+    std::vector<std::int64_t> hull_indices_;
+    std::vector<Point<T>> merged_points_;
+    std::vector<std::int64_t> merged_indices_;
+    std::vector<int> chunk_hull_;
+    ConvexHullMergeBuffers<T> merge_buffers_;
+    ConvexHullWorkspace<T> workspace_;
+};
+
+/// @brief Triangle of the 3D Quickhull mesh, counterclockwise when viewed from outside. Edge i runs from vertices[i]
+/// to vertices[(i + 1) % 3] and is shared with face neighbours[i].
+template <typename T> struct QuickhullFace3
+{
+    int vertices[3];
+    int neighbours[3];
+    T origin[3];        // First vertex
+    T normal[3];        // Cross product of the edges from the first vertex
+    T permanent[3];     // Magnitudes of the products in the normal, which bound its rounding error
+    int conflict_head;  // First point of the outside set, linked through the next_conflicts array
+    int furthest;       // Point of the outside set furthest above the face, or -1 if the set is empty
+    T furthest_volume;  // Orientation volume of the furthest point, proportional to its distance
+    int visit;          // Iteration in which the face was last tested for visibility
+    bool is_visible;    // Visibility from the point of that iteration
+    bool is_alive;
+};
+
+/// @brief Horizon edge (from, to) of the faces visible from a new hull vertex, bordering the invisible face neighbour
+/// across its edge neighbour_edge
+struct QuickhullHorizonEdge3
+{
+    int from, to, neighbour, neighbour_edge;
+};
+
+/// @brief Scratch buffers of the 3D Quickhull reused across constructions. Faces and conflict lists live in pooled
+/// arrays, so repeated constructions with the same workspace make no heap allocations once the buffers have grown.
+template <typename T> struct ConvexHull3Workspace
+{
+    using Volume = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+    std::vector<QuickhullFace3<Volume>> faces;       // Face pool, including deleted faces
+    std::vector<int> free_faces;                     // Deleted faces available for reuse
+    std::vector<int> next_conflicts;                 // Next point in the outside set of the same face, or -1
+    std::vector<int> pending_faces;                  // Faces whose outside sets may be nonempty
+    std::vector<int> visible_faces;                  // Faces visible from the current point
+    std::vector<int> new_faces;                      // Faces created for the current point, in horizon order
+    std::vector<QuickhullHorizonEdge3> horizon;      // Horizon edges of the current point
+    std::vector<int> horizon_edge_by_vertex;         // Horizon edge starting at each vertex, or -1
+};
+
+/// @brief Construct 3D Convex Hull using Quickhull, storing three point indices per triangle, counterclockwise when
+/// viewed from outside. Orientation tests are exact, so the result is a closed convex mesh for any input. Flat facets
+/// are triangulated and may keep vertices that lie within them, and the hull is empty if all points are coplanar.
+template <typename T, typename Points>
+void constructConvexHull3(const Points &points, std::vector<int> &triangle_indices, ConvexHull3Workspace<T> &workspace)
+{
+    using Volume = typename ConvexHull3Workspace<T>::Volume;
+    using Face = QuickhullFace3<Volume>;
+
+    triangle_indices.clear();
+    const int n = static_cast<int>(points.size());
+    if (n < 4)
+    {
+        return;
+    }
+
+    // Faces store their plane, so that orientation tests of points against a face take a single dot product, which
+    // has the same error bound as the orient3d filter with the rows of the determinant permuted
+    const auto initialize_face = [&](Face &face, int i0, int i1, int i2) noexcept {
+        face.vertices[0] = i0;
+        face.vertices[1] = i1;
+        face.vertices[2] = i2;
+        const Point3<T> &p0 = points[i0];
+        const Point3<T> &p1 = points[i1];
+        const Point3<T> &p2 = points[i2];
+        const Volume u[3] = {Volume(p1.x) - Volume(p0.x), Volume(p1.y) - Volume(p0.y), Volume(p1.z) - Volume(p0.z)};
+        const Volume v[3] = {Volume(p2.x) - Volume(p0.x), Volume(p2.y) - Volume(p0.y), Volume(p2.z) - Volume(p0.z)};
+        face.origin[0] = Volume(p0.x);
+        face.origin[1] = Volume(p0.y);
+        face.origin[2] = Volume(p0.z);
+        for (int i = 0; i < 3; ++i)
+        {
+            const int j = (i + 1) % 3;
+            const int k = (i + 2) % 3;
+            face.normal[i] = u[j] * v[k] - u[k] * v[j];
+            face.permanent[i] = std::fabs(u[j] * v[k]) + std::fabs(u[k] * v[j]);
+        }
+        face.conflict_head = -1;
+        face.furthest = -1;
+        face.furthest_volume = 0;
+        face.is_visible = false;
+        face.is_alive = true;
+    };
+    const auto orientation = [&](const Face &face, int index, Volume &volume) noexcept {
+        const Point3<T> &point = points[index];
+        const Volume w[3] = {Volume(point.x) - face.origin[0], Volume(point.y) - face.origin[1],
+                             Volume(point.z) - face.origin[2]};
+        volume = face.normal[0] * w[0] + face.normal[1] * w[1] + face.normal[2] * w[2];
+        if constexpr (std::is_integral<T>::value || CONVEX_HULL_ROBUST_PREDICATES)
+        {
+            const Volume permanent = face.permanent[0] * std::fabs(w[0]) + face.permanent[1] * std::fabs(w[1]) +
+                                     face.permanent[2] * std::fabs(w[2]);
+            const Volume error_bound = getOrientation3ErrorBound<Volume>() * permanent;
+            if (getAbsoluteValue(volume) < error_bound)
+            {
+                return getOrientationSign<T>(points[face.vertices[0]], points[face.vertices[1]],
+                                             points[face.vertices[2]], point);
+            }
+        }
+        return (volume > 0) - (volume < 0);
+    };
+    const auto squared_distance = [&](int i1, int i2) noexcept {
+        const Point3<T> &p1 = points[i1];
+        const Point3<T> &p2 = points[i2];
+        const Volume dx = Volume(p2.x) - Volume(p1.x);
+        const Volume dy = Volume(p2.y) - Volume(p1.y);
+        const Volume dz = Volume(p2.z) - Volume(p1.z);
+        return dx * dx + dy * dy + dz * dz;
+    };
+
+    // Initial simplex: the two most distant of the extreme points along each axis, the point furthest from the line
+    // through them and the point furthest from the plane through all three
+    int extremes[6] = {0, 0, 0, 0, 0, 0};
+    for (int i = 1; i < n; ++i)
+    {
+        const Point3<T> &point = points[i];
+        const T coordinates[3] = {point.x, point.y, point.z};
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const Point3<T> &low = points[extremes[2 * axis]];
+            const Point3<T> &high = points[extremes[2 * axis + 1]];
+            const T lows[3] = {low.x, low.y, low.z};
+            const T highs[3] = {high.x, high.y, high.z};
+            if (coordinates[axis] < lows[axis])
+            {
+                extremes[2 * axis] = i;
+            }
+            if (coordinates[axis] > highs[axis])
+            {
+                extremes[2 * axis + 1] = i;
+            }
+        }
+    }
+
+    int v0 = 0, v1 = 0;
+    Volume max_distance = 0;
+    for (int i = 0; i < 6; ++i)
+    {
+        for (int j = i + 1; j < 6; ++j)
+        {
+            const Volume distance = squared_distance(extremes[i], extremes[j]);
+            if (distance > max_distance)
+            {
+                max_distance = distance;
+                v0 = extremes[i];
+                v1 = extremes[j];
+            }
+        }
+    }
+    if (max_distance == 0)
+    {
+        return;
+    }
+
+    int v2 = -1;
+    Volume max_area = 0;
+    {
+        const Point3<T> &p0 = points[v0];
+        const Point3<T> &p1 = points[v1];
+        const Volume ux = Volume(p1.x) - Volume(p0.x);
+        const Volume uy = Volume(p1.y) - Volume(p0.y);
+        const Volume uz = Volume(p1.z) - Volume(p0.z);
+        for (int i = 0; i < n; ++i)
+        {
+            const Point3<T> &point = points[i];
+            const Volume wx = Volume(point.x) - Volume(p0.x);
+            const Volume wy = Volume(point.y) - Volume(p0.y);
+            const Volume wz = Volume(point.z) - Volume(p0.z);
+            const Volume cx = uy * wz - uz * wy;
+            const Volume cy = uz * wx - ux * wz;
+            const Volume cz = ux * wy - uy * wx;
+            const Volume area = cx * cx + cy * cy + cz * cz;
+            if (area > max_area)
+            {
+                max_area = area;
+                v2 = i;
+            }
+        }
+    }
+    if (v2 < 0)
+    {
+        return;
+    }
+
+    Face base;
+    initialize_face(base, v0, v1, v2);
+    int v3 = -1;
+    int v3_orientation = 0;
+    Volume max_volume = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        Volume volume;
+        const int sign = orientation(base, i, volume);
+        if (sign != 0 && (v3 < 0 || std::fabs(volume) > max_volume))
+        {
+            max_volume = std::fabs(volume);
+            v3 = i;
+            v3_orientation = sign;
+        }
+    }
+    if (v3 < 0)
+    {
+        // All points are coplanar
+        return;
+    }
+    if (v3_orientation > 0)
+    {
+        std::swap(v1, v2);
+    }
+
+    // Tetrahedron with v3 below the face (v0, v1, v2), so that every face is counterclockwise from outside
+    auto &faces = workspace.faces;
+    auto &free_faces = workspace.free_faces;
+    faces.clear();
+    free_faces.clear();
+    const int tetrahedron[4][3] = {{v0, v1, v2}, {v0, v3, v1}, {v1, v3, v2}, {v2, v3, v0}};
+    faces.resize(4);
+    for (int f = 0; f < 4; ++f)
+    {
+        initialize_face(faces[f], tetrahedron[f][0], tetrahedron[f][1], tetrahedron[f][2]);
+        faces[f].visit = -1;
+    }
+    for (int f = 0; f < 4; ++f)
+    {
+        for (int e = 0; e < 3; ++e)
+        {
+            const int from = faces[f].vertices[e];
+            const int to = faces[f].vertices[(e + 1) % 3];
+            for (int g = 0; g < 4; ++g)
+            {
+                for (int k = 0; k < 3; ++k)
+                {
+                    if (faces[g].vertices[k] == to && faces[g].vertices[(k + 1) % 3] == from)
+                    {
+                        faces[f].neighbours[e] = g;
+                    }
+                }
+            }
+        }
+    }
+
+    // Adds point to the outside set of the first of the faces [first, last) that it lies strictly above, and returns
+    // false if there is none
+    auto &next_conflicts = workspace.next_conflicts;
+    next_conflicts.assign(n, -1);
+    const auto assign_point = [&](int index, const int *first, const int *last) noexcept {
+        for (const int *it = first; it != last; ++it)
+        {
+            auto &face = faces[*it];
+            Volume volume;
+            if (orientation(face, index, volume) > 0)
+            {
+                next_conflicts[index] = face.conflict_head;
+                face.conflict_head = index;
+                if (face.furthest < 0 || volume > face.furthest_volume)
+                {
+                    face.furthest = index;
+                    face.furthest_volume = volume;
+                }
+                return true;
+            }
+        }
+        return false;
+    };
+
+    const int initial_faces[4] = {0, 1, 2, 3};
+    for (int i = 0; i < n; ++i)
+    {
+        if (i != v0 && i != v1 && i != v2 && i != v3)
+        {
+            assign_point(i, initial_faces, initial_faces + 4);
+        }
+    }
+
+    auto &pending_faces = workspace.pending_faces;
+    auto &visible_faces = workspace.visible_faces;
+    auto &new_faces = workspace.new_faces;
+    auto &horizon = workspace.horizon;
+    auto &horizon_edge_by_vertex = workspace.horizon_edge_by_vertex;
+    pending_faces.assign(initial_faces, initial_faces + 4);
+    horizon_edge_by_vertex.assign(n, -1);
+
+    for (int iteration = 0; !pending_faces.empty(); ++iteration)
+    {
+        const int start = pending_faces.back();
+        pending_faces.pop_back();
+        if (!faces[start].is_alive || faces[start].furthest < 0)
+        {
+            continue;
+        }
+        const int eye = faces[start].furthest;
+
+        // Collect the faces visible from the eye point, which form a disc around the start face since orientation
+        // tests are exact, and the horizon edges bordering it
+        visible_faces.clear();
+        horizon.clear();
+        bool is_disc = true;
+        visible_faces.push_back(start);
+        faces[start].visit = iteration;
+        faces[start].is_visible = true;
+        for (std::size_t v = 0; v < visible_faces.size(); ++v)
+        {
+            const int f = visible_faces[v];
+            for (int e = 0; e < 3; ++e)
+            {
+                const int g = faces[f].neighbours[e];
+                auto &neighbour = faces[g];
+                if (neighbour.visit != iteration)
+                {
+                    Volume volume;
+                    neighbour.visit = iteration;
+                    neighbour.is_visible = orientation(neighbour, eye, volume) > 0;
+                    if (neighbour.is_visible)
+                    {
+                        visible_faces.push_back(g);
+                    }
+                }
+                if (!neighbour.is_visible)
+                {
+                    int neighbour_edge = 0;
+                    while (neighbour_edge < 3 && neighbour.neighbours[neighbour_edge] != f)
+                    {
+                        ++neighbour_edge;
+                    }
+                    const int from = faces[f].vertices[e];
+                    is_disc = is_disc && neighbour_edge < 3 && horizon_edge_by_vertex[from] < 0;
+                    horizon_edge_by_vertex[from] = static_cast<int>(horizon.size());
+                    horizon.push_back({from, faces[f].vertices[(e + 1) % 3], g, neighbour_edge});
+                }
+            }
+        }
+
+        // Inexact fast predicates may find visible faces that do not form a disc, bounded by a single horizon loop,
+        // in which case the eye point is dropped rather than corrupting the mesh
+        int edge = 0;
+        std::size_t loop_size = 0;
+        do
+        {
+            edge = horizon_edge_by_vertex[horizon[edge].to];
+            ++loop_size;
+        } while (edge > 0 && loop_size < horizon.size());
+        if (!is_disc || edge != 0 || loop_size != horizon.size())
+        {
+            for (const auto &horizon_edge : horizon)
+            {
+                horizon_edge_by_vertex[horizon_edge.from] = -1;
+            }
+            auto &face = faces[start];
+            face.furthest = -1;
+            for (int *link = &face.conflict_head; *link >= 0;)
+            {
+                if (*link == eye)
+                {
+                    *link = next_conflicts[eye];
+                    continue;
+                }
+                Volume volume;
+                orientation(face, *link, volume);
+                if (face.furthest < 0 || volume > face.furthest_volume)
+                {
+                    face.furthest = *link;
+                    face.furthest_volume = volume;
+                }
+                link = &next_conflicts[*link];
+            }
+            if (face.furthest >= 0)
+            {
+                pending_faces.push_back(start);
+            }
+            continue;
+        }
+
+        // Cone the horizon to the eye point, walking the horizon loop so that consecutive new faces are neighbours
+        new_faces.clear();
+        for (std::size_t k = 0; k < horizon.size(); ++k)
+        {
+            const auto &horizon_edge = horizon[edge];
+            int f;
+            if (free_faces.empty())
+            {
+                f = static_cast<int>(faces.size());
+                faces.emplace_back();
+            }
+            else
+            {
+                f = free_faces.back();
+                free_faces.pop_back();
+            }
+            initialize_face(faces[f], horizon_edge.from, horizon_edge.to, eye);
+            faces[f].neighbours[0] = horizon_edge.neighbour;
+            faces[f].visit = iteration;
+            faces[horizon_edge.neighbour].neighbours[horizon_edge.neighbour_edge] = f;
+            if (!new_faces.empty())
+            {
+                faces[f].neighbours[2] = new_faces.back();
+                faces[new_faces.back()].neighbours[1] = f;
+            }
+            new_faces.push_back(f);
+            horizon_edge_by_vertex[horizon_edge.from] = -1;
+            edge = horizon_edge_by_vertex[horizon_edge.to];
+        }
+        faces[new_faces.front()].neighbours[2] = new_faces.back();
+        faces[new_faces.back()].neighbours[1] = new_faces.front();
+
+        // Move outside sets of visible faces to the new faces, dropping points that are now inside the hull
+        for (const int f : visible_faces)
+        {
+            for (int index = faces[f].conflict_head; index >= 0;)
+            {
+                const int next = next_conflicts[index];
+                if (index != eye)
+                {
+                    assign_point(index, new_faces.data(), new_faces.data() + new_faces.size());
+                }
+                index = next;
+            }
+            faces[f].is_alive = false;
+            free_faces.push_back(f);
+        }
+        for (const int f : new_faces)
+        {
+            if (faces[f].furthest >= 0)
+            {
+                pending_faces.push_back(f);
+            }
+        }
     }
+
+    for (const auto &face : faces)
+    {
+        if (face.is_alive)
+        {
+            triangle_indices.insert(triangle_indices.end(), face.vertices, face.vertices + 3);
+        }
     }
 }
 
+/// @brief Construct 3D Convex Hull using Quickhull, returning three point indices per triangle, counterclockwise when
+/// viewed from outside
+template <typename Points, typename T = PointCoordinate<Points>>
+std::vector<int> constructConvexHull3(const Points &points)
+{
+    ConvexHull3Workspace<T> workspace;
+    std::vector<int> triangle_indices;
+    constructConvexHull3(points, triangle_indices, workspace);
+    return triangle_indices;
+}
+
 } // namespace geom
 
 #endif // CONVEX_HULL_HPP
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "convex_hull.hpp"
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace
+{
+using namespace geom;
+
+/// @brief Non-owning view of the rows of an (N, 2) NumPy array of one of the supported coordinate types
+using PointArrayView =
+    std::variant<PointView<double>, PointView<float>, PointView<std::int32_t>, PointView<std::int64_t>>;
+
+/// @brief Returns a view of the rows of an (N, 2) array of T over its memory, contiguous or strided. Arrays whose
+/// elements are not aligned to T, such as packed record fields, are copied first, and the copy is kept in storage.
+template <typename T> PointView<T> getPointView(const py::array &points, py::object &storage)
+{
+    py::array array = points;
+    if (reinterpret_cast<std::uintptr_t>(array.data()) % alignof(T) != 0 || array.strides(0) % alignof(T) != 0 ||
+        array.strides(1) % alignof(T) != 0)
+    {
+        array = py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(points);
+        storage = array;
+    }
+
+    const auto *data = static_cast<const char *>(array.data());
+    return PointView<T>(reinterpret_cast<const T *>(data), reinterpret_cast<const T *>(data + array.strides(1)),
+                        static_cast<std::size_t>(array.shape(0)), array.strides(0));
+}
+
+/// @brief Returns a view of an (N, 2) float64, float32, int32 or int64 array without copying its coordinates. Other
+/// sequences are converted to float64 arrays, which are kept in storage.
+PointArrayView getPointArrayView(py::handle object, py::object &storage)
+{
+    py::array points;
+    if (py::isinstance<py::array>(object))
+    {
+        points = py::reinterpret_borrow<py::array>(object);
+    }
+    else
+    {
+        points = py::array_t<double, py::array::c_style | py::array::forcecast>::ensure(object);
+        if (!points)
+        {
+            throw py::type_error("points must be an array of shape (N, 2)");
+        }
+        storage = points;
+    }
+
+    if (points.ndim() != 2 || points.shape(1) != 2)
+    {
+        throw py::value_error("points must be an array of shape (N, 2)");
+    }
+    if (points.shape(0) > std::numeric_limits<int>::max())
+    {
+        throw py::value_error("points must have fewer than 2^31 rows");
+    }
+
+    if (py::isinstance<py::array_t<double>>(points))
+    {
+        return getPointView<double>(points, storage);
+    }
+    if (py::isinstance<py::array_t<float>>(points))
+    {
+        return getPointView<float>(points, storage);
+    }
+    if (py::isinstance<py::array_t<std::int32_t>>(points))
+    {
+        return getPointView<std::int32_t>(points, storage);
+    }
+    if (py::isinstance<py::array_t<std::int64_t>>(points))
+    {
+        const PointView<std::int64_t> view = getPointView<std::int64_t>(points, storage);
+        if (!hasExactCoordinates(view))
+        {
+            throw py::value_error("int64 coordinates must have magnitude below 2^62");
+        }
+        return view;
+    }
+    throw py::type_error("points must be a float64, float32, int32 or int64 array");
+}
+
+/// @brief Returns hull indices as an int64 NumPy array
+py::array_t<std::int64_t> getIndexArray(const std::vector<int> &hull_indices)
+{
+    py::array_t<std::int64_t> array(static_cast<py::ssize_t>(hull_indices.size()));
+    std::int64_t *data = array.mutable_data();
+    for (std::size_t i = 0; i < hull_indices.size(); ++i)
+    {
+        data[i] = hull_indices[i];
+    }
+    return array;
+}
+
+/// @brief Constructs the hull of an (N, 2) array, with the GIL released while the hull is computed
+py::array_t<std::int64_t> constructConvexHullFromArray(const py::object &points, ConvexHullAlgorithm algorithm,
+                                                       Orientation orientation, ConvexHullReturnType return_type)
+{
+    py::object storage;
+    const PointArrayView view = getPointArrayView(points, storage);
+
+    std::vector<int> hull_indices;
+    {
+        py::gil_scoped_release release;
+        std::visit(
+            [&](const auto &point_view) {
+                hull_indices = constructConvexHull(point_view, algorithm, orientation, return_type);
+            },
+            view);
+    }
+    return getIndexArray(hull_indices);
+}
+
+/// @brief Constructs the hulls of a list of (N, 2) arrays on up to number_of_threads threads, where 0 requests one
+/// thread per hardware thread, with the GIL released while the hulls are computed. When the sets are hulled on more
+/// than one thread, AUTO selects only serial algorithms.
+py::list constructConvexHullsFromArrays(const py::list &point_sets, ConvexHullAlgorithm algorithm,
+                                        Orientation orientation, ConvexHullReturnType return_type,
+                                        int number_of_threads)
+{
+    // Arrays converted from other sequences are kept alive by storages until the hulls are computed
+    const int number_of_sets = static_cast<int>(point_sets.size());
+    std::vector<py::object> storages(number_of_sets);
+    std::vector<PointArrayView> views;
+    views.reserve(number_of_sets);
+    for (int set_no = 0; set_no < number_of_sets; ++set_no)
+    {
+        const py::object points = point_sets[set_no];
+        views.push_back(getPointArrayView(points, storages[set_no]));
+    }
+
+    // Sets hulled on several threads already occupy them, so AUTO is kept to its serial selections rather than
+    // oversubscribing the machine with a parallel algorithm per set
+    const bool is_parallel_batch = std::min(getNumberOfThreads(number_of_threads), number_of_sets) > 1;
+
+    std::vector<std::vector<int>> hull_indices(number_of_sets);
+    {
+        py::gil_scoped_release release;
+        runParallelTasks(number_of_sets, number_of_threads, [&](int set_no) {
+            std::visit(
+                [&](const auto &point_view) {
+                    ConvexHullWorkspace<PointCoordinate<std::decay_t<decltype(point_view)>>> workspace;
+                    if (is_parallel_batch)
+                    {
+                        workspace.auto_thresholds.min_parallel_size = std::numeric_limits<int>::max();
+                    }
+                    constructConvexHull(point_view, hull_indices[set_no], workspace, algorithm, orientation,
+                                        return_type);
+                },
+                views[set_no]);
+        });
+    }
+
+    py::list hulls;
+    for (const auto &indices : hull_indices)
+    {
+        hulls.append(getIndexArray(indices));
+    }
+    return hulls;
+}
+} // namespace
+
+PYBIND11_MODULE(convex_hull, module)
+{
+    module.doc() = "Convex hulls of NumPy point arrays";
+
+    py::enum_<ConvexHullAlgorithm>(module, "Algorithm")
+        .value("GRAHAM_SCAN", ConvexHullAlgorithm::GRAHAM_SCAN)
+        .value("ANDREW_MONOTONE_CHAIN", ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN)
+        .value("JARVIS_MARCH", ConvexHullAlgorithm::JARVIS_MARCH)
+        .value("CHAN", ConvexHullAlgorithm::CHAN)
+        .value("PARALLEL_ANDREW_MONOTONE_CHAIN", ConvexHullAlgorithm::PARALLEL_ANDREW_MONOTONE_CHAIN)
+        .value("QUICKHULL", ConvexHullAlgorithm::QUICKHULL)
+        .value("PARALLEL_QUICKHULL", ConvexHullAlgorithm::PARALLEL_QUICKHULL)
+        .value("MELKMAN", ConvexHullAlgorithm::MELKMAN)
+        .value("APPROXIMATE", ConvexHullAlgorithm::APPROXIMATE)
+        .value("AUTO", ConvexHullAlgorithm::AUTO);
+
+    py::enum_<Orientation>(module, "Orientation")
+        .value("COUNTERCLOCKWISE", Orientation::COUNTERCLOCKWISE)
+        .value("CLOCKWISE", Orientation::CLOCKWISE);
+
+    py::enum_<ConvexHullReturnType>(module, "ReturnType")
+        .value("OPEN", ConvexHullReturnType::OPEN)
+        .value("ENCLOSED", ConvexHullReturnType::ENCLOSED);
+
+    module.def("convex_hull", &constructConvexHullFromArray, py::arg("points"),
+               py::arg("algorithm") = ConvexHullAlgorithm::GRAHAM_SCAN,
+               py::arg("orientation") = Orientation::COUNTERCLOCKWISE,
+               py::arg("return_type") = ConvexHullReturnType::OPEN,
+               "Returns int64 indices of the hull vertices of an (N, 2) float64, float32, int32 or int64 array, read "
+               "in place, whether contiguous or strided. Other sequences are converted to float64. As in C++, the "
+               "algorithm defaults to GRAHAM_SCAN.");
+
+    module.def("convex_hulls", &constructConvexHullsFromArrays, py::arg("point_sets"),
+               py::arg("algorithm") = ConvexHullAlgorithm::GRAHAM_SCAN,
+               py::arg("orientation") = Orientation::COUNTERCLOCKWISE,
+               py::arg("return_type") = ConvexHullReturnType::OPEN, py::arg("number_of_threads") = 0,
+               "Returns a list with the hull indices of every (N, 2) array in point_sets, computed on up to "
+               "number_of_threads threads, where 0 uses every hardware thread, and AUTO then selects only serial "
+               "algorithms. As in C++, the algorithm defaults to GRAHAM_SCAN.");
+}
@@ -1,6 +1,8 @@
 #include "convex_hull.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 #include <random>
 
@@ -144,5 +146,235 @@ int main()
         printConvexHullIndices(indices, print_results);
     }
 
+    // Construct convex hull using PARALLEL ANDREW MONOTONE CHAIN
+    {
+        std::cout << std::endl << "Constructing convex hull using PARALLEL ANDREW MONOTONE CHAIN " << std::endl;
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        auto indices = constructConvexHull(points, ConvexHullAlgorithm::PARALLEL_ANDREW_MONOTONE_CHAIN, orientation);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of hull points: " << indices.size() << std::endl;
+
+        // Print hull orientation
+        printHullOrientation(points, indices);
+
+        // Print hull indices
+        printConvexHullIndices(indices, print_results);
+    }
+
+    // Construct convex hull using QUICKHULL
+    {
+        std::cout << std::endl << "Constructing convex hull using QUICKHULL " << std::endl;
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        auto indices = constructConvexHull(points, ConvexHullAlgorithm::QUICKHULL, orientation);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of hull points: " << indices.size() << std::endl;
+
+        // Print hull orientation
+        printHullOrientation(points, indices);
+
+        // Print hull indices
+        printConvexHullIndices(indices, print_results);
+    }
+
+    // Construct convex hull using PARALLEL QUICKHULL
+    {
+        std::cout << std::endl << "Constructing convex hull using PARALLEL QUICKHULL " << std::endl;
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        auto indices = constructConvexHull(points, ConvexHullAlgorithm::PARALLEL_QUICKHULL, orientation);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of hull points: " << indices.size() << std::endl;
+
+        // Print hull orientation
+        printHullOrientation(points, indices);
+
+        // Print hull indices
+        printConvexHullIndices(indices, print_results);
+    }
+
+    // Construct convex hull using MELKMAN, over the points ordered by angle around their centroid, which form a
+    // simple polygon
+    {
+        std::cout << std::endl << "Constructing convex hull using MELKMAN " << std::endl;
+
+        Point<PointType> centroid(0, 0);
+        for (const auto &point : points)
+        {
+            centroid.x += point.x / num_pts;
+            centroid.y += point.y / num_pts;
+        }
+        auto polygon = points;
+        std::sort(polygon.begin(), polygon.end(), [&](const auto &p1, const auto &p2) {
+            return std::atan2(p1.y - centroid.y, p1.x - centroid.x) < std::atan2(p2.y - centroid.y, p2.x - centroid.x);
+        });
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        auto indices = constructConvexHull(polygon, ConvexHullAlgorithm::MELKMAN, orientation);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of hull points: " << indices.size() << std::endl;
+
+        // Print hull orientation
+        printHullOrientation(polygon, indices);
+
+        // Print hull indices
+        printConvexHullIndices(indices, print_results);
+    }
+
+    // Construct convex hull using AUTO, which selects the algorithm from a sample of the points
+    {
+        std::cout << std::endl << "Constructing convex hull using AUTO " << std::endl;
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        auto indices = constructConvexHull(points, ConvexHullAlgorithm::AUTO, orientation);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of hull points: " << indices.size() << std::endl;
+
+        // Print hull orientation
+        printHullOrientation(points, indices);
+
+        // Print hull indices
+        printConvexHullIndices(indices, print_results);
+    }
+
+    // Construct approximate convex hull, whose error bound is reported through the workspace
+    {
+        std::cout << std::endl << "Constructing convex hull using APPROXIMATE " << std::endl;
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        ConvexHullWorkspace<PointType> workspace;
+        std::vector<int> indices;
+        constructConvexHull(points, indices, workspace, ConvexHullAlgorithm::APPROXIMATE, orientation);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of hull points: " << indices.size() << std::endl;
+        std::cout << "Error bound: " << workspace.approximation_error << std::endl;
+
+        // Print hull orientation
+        printHullOrientation(points, indices);
+
+        // Print hull indices
+        printConvexHullIndices(indices, print_results);
+    }
+
+    // Construct hulls of 64 consecutive point sets, then merge them into the hull of all points
+    {
+        std::cout << std::endl << "Merging convex hulls of point sets using MERGE " << std::endl;
+
+        std::vector<int> offsets;
+        for (int set_no = 0; set_no <= 64; ++set_no)
+        {
+            offsets.push_back(static_cast<int>(points.size() * set_no / 64));
+        }
+        std::vector<int> hull_indices, hull_offsets;
+        constructConvexHulls(points, offsets, hull_indices, hull_offsets);
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        auto indices = mergeConvexHulls(points, hull_indices, hull_offsets, orientation);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of input hull points: " << hull_indices.size() << std::endl;
+        std::cout << "Number of hull points: " << indices.size() << std::endl;
+
+        // Print hull orientation
+        printHullOrientation(points, indices);
+
+        // Print hull indices
+        printConvexHullIndices(indices, print_results);
+    }
+
+    // Construct convex hull by streaming points into DYNAMIC CONVEX HULL
+    {
+        std::cout << std::endl << "Constructing convex hull using DYNAMIC CONVEX HULL " << std::endl;
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        DynamicConvexHull<PointType> dynamic_hull;
+        for (int i = 0; i < static_cast<int>(points.size()); ++i)
+        {
+            dynamic_hull.insert(points[i], i);
+        }
+        auto indices = dynamic_hull.getHullIndices(orientation);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of hull points: " << indices.size() << std::endl;
+
+        // Print hull orientation
+        printHullOrientation(points, indices);
+
+        // Print hull indices
+        printConvexHullIndices(indices, print_results);
+    }
+
+    // Query the hull with CONVEX POLYGON, testing containment of every input point at once
+    {
+        std::cout << std::endl << "Querying convex hull using CONVEX POLYGON " << std::endl;
+
+        ConvexPolygon<PointType> polygon(points, constructConvexHull(points));
+        PointArray<PointType> point_array(points);
+        std::vector<std::uint8_t> is_inside;
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        polygon.contains(point_array, is_inside);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of points inside: " << std::count(is_inside.begin(), is_inside.end(), 1) << std::endl;
+        std::cout << "Rightmost hull point: "
+                  << polygon.getIndex(polygon.findExtremeVertex(Point<PointType>(1, 0))) << std::endl;
+    }
+
+    // Construct 3D convex hull using QUICKHULL, over the points lifted to random heights
+    {
+        std::cout << std::endl << "Constructing 3D convex hull using QUICKHULL " << std::endl;
+
+        std::vector<Point3<PointType>> points3;
+        points3.reserve(num_pts);
+        for (const auto &point : points)
+        {
+            points3.emplace_back(point.x, point.y, distribution(generator));
+        }
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+
+        auto triangle_indices = constructConvexHull3(points3);
+
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::cout << "Elapsed time (s): " << (t2 - t1).count() / 1e9 << std::endl;
+        std::cout << "Number of hull triangles: " << triangle_indices.size() / 3 << std::endl;
+    }
+
     return 0;
 }
\ No newline at end of file
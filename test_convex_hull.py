@@ -0,0 +1,45 @@
+"""Smoke test of the convex_hull Python module, run by ctest when the bindings are built"""
+
+import numpy as np
+
+import convex_hull
+
+# Corners of the unit square, shuffled among interior points
+square = np.array([[0.5, 0.5], [0.0, 0.0], [0.25, 0.75], [1.0, 0.0], [1.0, 1.0], [0.5, 0.25], [0.0, 1.0]])
+corners = {1, 3, 4, 6}
+
+for dtype in (np.float64, np.float32, np.int32, np.int64):
+    points = (square * 4).astype(dtype)
+    indices = convex_hull.convex_hull(points)
+    assert indices.dtype == np.int64, indices.dtype
+    assert set(indices.tolist()) == corners, (dtype, indices)
+
+for algorithm in convex_hull.Algorithm.__members__.values():
+    if algorithm in (convex_hull.Algorithm.MELKMAN, convex_hull.Algorithm.APPROXIMATE):
+        continue
+    assert set(convex_hull.convex_hull(square, algorithm).tolist()) == corners, algorithm
+
+# Full-range int32 coordinates are exact, int64 coordinates from 2^62 on are rejected
+limit = np.iinfo(np.int32).max
+assert set(convex_hull.convex_hull(((square * 2 - 1) * limit).astype(np.int32)).tolist()) == corners
+try:
+    convex_hull.convex_hull(np.array([[0, 0], [2**62, 0], [0, 1]], dtype=np.int64))
+    raise AssertionError("int64 coordinates of magnitude 2^62 were accepted")
+except ValueError:
+    pass
+
+# Strided views are read in place, and other sequences are converted to float64
+assert set(convex_hull.convex_hull(square[:, ::-1]).tolist()) == corners
+assert set(convex_hull.convex_hull(square.tolist()).tolist()) == corners
+
+# Batches on several threads match the hulls computed one by one
+rng = np.random.default_rng(1)
+point_sets = [rng.random((size, 2)) for size in (3, 100, 10_000, 100_000)]
+for number_of_threads in (1, 4):
+    hulls = convex_hull.convex_hulls(point_sets, convex_hull.Algorithm.AUTO, number_of_threads=number_of_threads)
+    assert len(hulls) == len(point_sets)
+    for points, hull in zip(point_sets, hulls):
+        expected = convex_hull.convex_hull(points, convex_hull.Algorithm.ANDREW_MONOTONE_CHAIN)
+        assert set(hull.tolist()) == set(expected.tolist())
+
+print("convex_hull Python module OK")
@@ -0,0 +1,2005 @@
+#include "convex_hull.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Checks every backend against a brute-force hull on degenerate inputs. Returns the number of failed checks, so that
+// ctest reports failures.
+
+/// @brief External point type whose coordinates are read through accessors, which PointSpan reads through a
+/// specialization of PointTraits
+template <typename T> class AccessorPoint
+{
+  public:
+    AccessorPoint(T x, T y) : coordinates_{x, y}
+    {
+    }
+
+    T getX() const
+    {
+        return coordinates_[0];
+    }
+
+    T getY() const
+    {
+        return coordinates_[1];
+    }
+
+  private:
+    T coordinates_[2];
+};
+
+template <typename T> struct geom::PointTraits<AccessorPoint<T>>
+{
+    using value_type = T;
+
+    static T getX(const AccessorPoint<T> &point) noexcept
+    {
+        return point.getX();
+    }
+
+    static T getY(const AccessorPoint<T> &point) noexcept
+    {
+        return point.getY();
+    }
+};
+
+namespace
+{
+using namespace geom;
+
+int number_of_failures = 0;
+std::string test_context;
+
+void check(bool condition, const char *expression, const char *file, int line)
+{
+    if (!condition)
+    {
+        if (++number_of_failures <= 20)
+        {
+            std::cerr << file << ":" << line << ": check failed: " << expression << " [" << test_context << "]"
+                      << std::endl;
+        }
+    }
+}
+
+#define CHECK(condition) check((condition), #condition, __FILE__, __LINE__)
+
+/// @brief Returns the distinct hull vertices of points in (y, x) order, found by testing every distinct point for
+/// containment in a segment or a triangle of the others in O(m^4)
+template <typename T> std::vector<Point<T>> constructBruteForceHull(const std::vector<Point<T>> &points)
+{
+    std::vector<Point<T>> distinct = points;
+    std::sort(distinct.begin(), distinct.end());
+    distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+    const int m = static_cast<int>(distinct.size());
+
+    const auto isBetween = [](const Point<T> &a, const Point<T> &b, const Point<T> &p) {
+        return getOrientationSign(a, b, p) == 0 && std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+               std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+    };
+
+    std::vector<Point<T>> hull;
+    for (int i = 0; i < m; ++i)
+    {
+        const auto &p = distinct[i];
+        bool is_covered = false;
+        for (int a = 0; a < m && !is_covered; ++a)
+        {
+            for (int b = a + 1; b < m && !is_covered; ++b)
+            {
+                if (a == i || b == i)
+                {
+                    continue;
+                }
+                is_covered = isBetween(distinct[a], distinct[b], p);
+                for (int c = b + 1; c < m && !is_covered; ++c)
+                {
+                    const int orientation = getOrientationSign(distinct[a], distinct[b], distinct[c]);
+                    if (c == i || orientation == 0)
+                    {
+                        continue;
+                    }
+                    is_covered = getOrientationSign(distinct[a], distinct[b], p) * orientation >= 0 &&
+                                 getOrientationSign(distinct[b], distinct[c], p) * orientation >= 0 &&
+                                 getOrientationSign(distinct[c], distinct[a], p) * orientation >= 0;
+                }
+            }
+        }
+        if (!is_covered)
+        {
+            hull.push_back(p);
+        }
+    }
+    return hull;
+}
+
+/// @brief Checks that hull_indices lists the expected vertices once each, in the requested orientation and return
+/// type. Fewer than 3 input points have an empty hull, unless has_small_hulls is set.
+template <typename T, typename Indices>
+void checkHull(const std::vector<Point<T>> &points, const Indices &hull_indices, const std::vector<Point<T>> &expected,
+               Orientation orientation, ConvexHullReturnType return_type, bool has_small_hulls = false)
+{
+    std::vector<long long> indices(hull_indices.begin(), hull_indices.end());
+    if (points.size() < 3 && !has_small_hulls)
+    {
+        CHECK(indices.empty());
+        return;
+    }
+    for (const auto index : indices)
+    {
+        CHECK(0 <= index && index < static_cast<long long>(points.size()));
+        if (index < 0 || index >= static_cast<long long>(points.size()))
+        {
+            return;
+        }
+    }
+    if (return_type == ConvexHullReturnType::ENCLOSED)
+    {
+        CHECK(!indices.empty() && indices.front() == indices.back());
+        if (!indices.empty())
+        {
+            indices.pop_back();
+        }
+    }
+
+    std::vector<Point<T>> vertices;
+    for (const auto index : indices)
+    {
+        vertices.push_back(points[index]);
+    }
+    std::vector<Point<T>> sorted_vertices = vertices;
+    std::sort(sorted_vertices.begin(), sorted_vertices.end());
+    CHECK(sorted_vertices == expected);
+
+    const int h = static_cast<int>(vertices.size());
+    const int expected_sign = (orientation == Orientation::COUNTERCLOCKWISE) ? 1 : -1;
+    for (int i = 0; h >= 3 && i < h; ++i)
+    {
+        CHECK(getOrientationSign(vertices[i], vertices[(i + 1) % h], vertices[(i + 2) % h]) == expected_sign);
+    }
+}
+
+/// @brief Hull construction under test, returning indices into points
+template <typename T> struct HullBackend
+{
+    std::string name;
+    std::function<std::vector<long long>(const std::vector<Point<T>> &, Orientation, ConvexHullReturnType)> construct;
+    bool has_small_hulls = false; // Returns the hull of fewer than 3 points rather than an empty one
+};
+
+template <typename Indices> std::vector<long long> toIndices(const Indices &indices)
+{
+    return std::vector<long long>(indices.begin(), indices.end());
+}
+
+/// @brief Workspace that owns the pool its parallel algorithms run on
+template <typename T> struct PooledWorkspace : ConvexHullWorkspace<T>
+{
+    PooledWorkspace()
+    {
+        this->thread_pool = &pool;
+    }
+
+    ConvexHullThreadPool pool;
+};
+
+/// @brief Returns every way of constructing a hull from a point set, labeled for failure messages
+template <typename T> std::vector<HullBackend<T>> getHullBackends()
+{
+    using Points = std::vector<Point<T>>;
+    using ReturnType = ConvexHullReturnType;
+    std::vector<HullBackend<T>> backends;
+    const std::pair<const char *, ConvexHullAlgorithm> algorithms[] = {
+        {"GRAHAM_SCAN", ConvexHullAlgorithm::GRAHAM_SCAN},
+        {"ANDREW_MONOTONE_CHAIN", ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN},
+        {"JARVIS_MARCH", ConvexHullAlgorithm::JARVIS_MARCH},
+        {"CHAN", ConvexHullAlgorithm::CHAN},
+        {"PARALLEL_ANDREW_MONOTONE_CHAIN", ConvexHullAlgorithm::PARALLEL_ANDREW_MONOTONE_CHAIN},
+        {"QUICKHULL", ConvexHullAlgorithm::QUICKHULL},
+        {"PARALLEL_QUICKHULL", ConvexHullAlgorithm::PARALLEL_QUICKHULL},
+        {"AUTO", ConvexHullAlgorithm::AUTO}};
+    const std::pair<const char *, ConvexHullFilter> filters[] = {{"", ConvexHullFilter::NONE},
+                                                                 {" QUADRILATERAL", ConvexHullFilter::QUADRILATERAL},
+                                                                 {" OCTAGON", ConvexHullFilter::OCTAGON}};
+
+    // Workspaces are shared by all calls, so that state left behind by previous inputs is exercised too. The shared
+    // workspace runs parallel algorithms on a pool of its own, the allocating overloads on the default pool.
+    auto workspace = std::make_shared<PooledWorkspace<T>>();
+    for (const auto &algorithm : algorithms)
+    {
+        for (const auto &filter : filters)
+        {
+            const auto construct = [=](const Points &points, Orientation orientation, ReturnType return_type) {
+                std::vector<int> hull_indices;
+                constructConvexHull(points, hull_indices, *workspace, algorithm.second, orientation, return_type,
+                                    filter.second);
+                return toIndices(hull_indices);
+            };
+            const auto construct_array = [=](const Points &points, Orientation orientation, ReturnType return_type) {
+                return toIndices(constructConvexHull(PointArray<T>(points), algorithm.second, orientation,
+                                                     return_type, filter.second));
+            };
+            const auto name = std::string(algorithm.first) + filter.first;
+            backends.push_back({name, construct});
+            backends.push_back({name + " PointArray", construct_array});
+        }
+    }
+
+    // Points held in memory of other layouts, read in place through views: interleaved x/y/z/intensity records,
+    // separate coordinate arrays, and arrays of external point types with public members or accessors
+    struct InterleavedPoint
+    {
+        T z;
+        T x;
+        float intensity;
+        T y;
+    };
+    struct ExternalPoint
+    {
+        T x, y;
+    };
+    const std::pair<const char *, std::function<std::vector<int>(const Points &, ConvexHullAlgorithm, Orientation,
+                                                                 ReturnType, ConvexHullFilter)>>
+        views[] = {
+            {" PointView interleaved",
+             [=](const Points &points, ConvexHullAlgorithm algorithm, Orientation orientation, ReturnType return_type,
+                 ConvexHullFilter filter) {
+                 std::vector<InterleavedPoint> cloud;
+                 for (const auto &point : points)
+                 {
+                     cloud.push_back({T(7), point.x, 0.5f, point.y});
+                 }
+                 const PointView<T> view(cloud.empty() ? nullptr : &cloud[0].x, cloud.empty() ? nullptr : &cloud[0].y,
+                                         cloud.size(), sizeof(InterleavedPoint));
+                 std::vector<int> hull_indices;
+                 constructConvexHull(view, hull_indices, *workspace, algorithm, orientation, return_type, filter);
+                 return hull_indices;
+             }},
+            {" PointView arrays",
+             [=](const Points &points, ConvexHullAlgorithm algorithm, Orientation orientation, ReturnType return_type,
+                 ConvexHullFilter filter) {
+                 std::vector<T> x, y;
+                 for (const auto &point : points)
+                 {
+                     x.push_back(point.x);
+                     y.push_back(point.y);
+                 }
+                 const PointView<T> view(x.data(), y.data(), x.size(), sizeof(T));
+                 std::vector<int> hull_indices;
+                 constructConvexHull(view, hull_indices, *workspace, algorithm, orientation, return_type, filter);
+                 return hull_indices;
+             }},
+            {" PointSpan members",
+             [](const Points &points, ConvexHullAlgorithm algorithm, Orientation orientation, ReturnType return_type,
+                ConvexHullFilter filter) {
+                 std::vector<ExternalPoint> external;
+                 for (const auto &point : points)
+                 {
+                     external.push_back({point.x, point.y});
+                 }
+                 return constructConvexHull(PointSpan<ExternalPoint>(external), algorithm, orientation, return_type,
+                                            filter);
+             }},
+            {" PointSpan accessors",
+             [](const Points &points, ConvexHullAlgorithm algorithm, Orientation orientation, ReturnType return_type,
+                ConvexHullFilter filter) {
+                 std::vector<AccessorPoint<T>> external;
+                 for (const auto &point : points)
+                 {
+                     external.emplace_back(point.x, point.y);
+                 }
+                 return constructConvexHull(PointSpan<AccessorPoint<T>>(external), algorithm, orientation,
+                                            return_type, filter);
+             }}};
+    for (const auto &algorithm : algorithms)
+    {
+        for (const auto &view : views)
+        {
+            for (const auto filter : {ConvexHullFilter::NONE, ConvexHullFilter::OCTAGON})
+            {
+                const auto construct_view = [=](const Points &points, Orientation orientation,
+                                                ReturnType return_type) {
+                    return toIndices(view.second(points, algorithm.second, orientation, return_type, filter));
+                };
+                backends.push_back({std::string(algorithm.first) + view.first +
+                                        (filter == ConvexHullFilter::OCTAGON ? " OCTAGON" : ""),
+                                    construct_view});
+            }
+        }
+    }
+
+    // Parallel algorithms with an explicit thread count, so that they split work on single-core machines too
+    const auto construct_parallel_chain = [=](const Points &points, Orientation orientation, ReturnType return_type) {
+        std::vector<int> hull_indices;
+        constructParallelAndrewMonotoneChainConvexHull(points, orientation, return_type, *workspace, hull_indices, 4);
+        return toIndices(hull_indices);
+    };
+    const auto construct_parallel_quickhull = [=](const Points &points, Orientation orientation,
+                                                  ReturnType return_type) {
+        std::vector<int> hull_indices;
+        constructQuickhullConvexHull(points, orientation, return_type, *workspace, hull_indices, 4);
+        return toIndices(hull_indices);
+    };
+    backends.push_back({"PARALLEL_ANDREW_MONOTONE_CHAIN 4 threads", construct_parallel_chain});
+    backends.push_back({"PARALLEL_QUICKHULL 4 threads", construct_parallel_quickhull});
+
+    // Batched hull of the whole set
+    const auto construct_batch = [=](const Points &points, Orientation orientation, ReturnType return_type) {
+        std::vector<int> hull_indices, hull_offsets;
+        constructConvexHulls(points, {0, static_cast<int>(points.size())}, hull_indices, hull_offsets, *workspace,
+                             orientation, return_type, 4);
+        return toIndices(hull_indices);
+    };
+    backends.push_back({"constructConvexHulls", construct_batch});
+
+    // Batched hull of the whole set, read through a view of separate coordinate arrays
+    const auto construct_batch_view = [=](const Points &points, Orientation orientation, ReturnType return_type) {
+        const PointArray<T> array(points);
+        std::vector<int> hull_indices, hull_offsets;
+        constructConvexHulls(PointView<T>(array), {0, static_cast<int>(points.size())}, hull_indices, hull_offsets,
+                             *workspace, orientation, return_type, 4);
+        return toIndices(hull_indices);
+    };
+    backends.push_back({"constructConvexHulls PointView", construct_batch_view});
+
+    // Dynamic hull, which also holds fewer than 3 points
+    const auto insert_dynamic = [](const Points &points, Orientation orientation, ReturnType return_type) {
+        DynamicConvexHull<T> hull;
+        for (int i = 0; i < static_cast<int>(points.size()); ++i)
+        {
+            hull.insert(points[i], i);
+        }
+        return toIndices(hull.getHullIndices(orientation, return_type));
+    };
+    backends.push_back({"DynamicConvexHull", insert_dynamic, true});
+
+    // Streaming hull fed in chunks of 1 to 4 points, so that chunks too small for a hull are merged too
+    const auto stream = [](const Points &points, Orientation orientation, ReturnType return_type) {
+        StreamingConvexHull<T> hull;
+        for (std::size_t first = 0, chunk_size = 1; first < points.size(); first += chunk_size)
+        {
+            chunk_size = 1 + first % 4;
+            const Points chunk(points.begin() + first, points.begin() + std::min(first + chunk_size, points.size()));
+            hull.insert(chunk);
+        }
+        return toIndices(hull.getHullIndices(orientation, return_type));
+    };
+    backends.push_back({"StreamingConvexHull", stream});
+    return backends;
+}
+
+/// @brief Checks every backend in both orientations and return types against the brute-force hull of points
+template <typename T>
+void checkBackends(const std::string &input_name, const std::vector<Point<T>> &points,
+                   const std::vector<HullBackend<T>> &backends)
+{
+    const auto expected = constructBruteForceHull(points);
+    for (const auto &backend : backends)
+    {
+        for (const auto orientation : {Orientation::COUNTERCLOCKWISE, Orientation::CLOCKWISE})
+        {
+            for (const auto return_type : {ConvexHullReturnType::OPEN, ConvexHullReturnType::ENCLOSED})
+            {
+                test_context = input_name + " n=" + std::to_string(points.size()) + " " + backend.name;
+                checkHull(points, backend.construct(points, orientation, return_type), expected, orientation,
+                          return_type, backend.has_small_hulls);
+            }
+        }
+    }
+}
+
+/// @brief Checks every backend on small random inputs with duplicate, collinear and coinciding points
+void testDegenerateInputs()
+{
+    std::mt19937 generator(7);
+    const auto int_backends = getHullBackends<int>();
+    const auto double_backends = getHullBackends<double>();
+
+    for (int trial = 0; trial < 40; ++trial)
+    {
+        const int n = 1 + trial % 24;
+
+        // Integer grid with many duplicate and collinear points
+        std::vector<Point<int>> grid;
+        std::uniform_int_distribution<int> grid_coordinate(0, 3);
+        for (int i = 0; i < n; ++i)
+        {
+            grid.emplace_back(grid_coordinate(generator), grid_coordinate(generator));
+        }
+        checkBackends("integer grid", grid, int_backends);
+
+        // Points that all coincide
+        checkBackends("coinciding", std::vector<Point<double>>(n, Point<double>(1.5, -2)), double_backends);
+
+        // Collinear points, with duplicates, along a diagonal and along both axes
+        for (const auto &direction : {Point<int>(3, -2), Point<int>(1, 0), Point<int>(0, 1)})
+        {
+            std::vector<Point<int>> line;
+            std::uniform_int_distribution<int> step(-4, 4);
+            for (int i = 0; i < n; ++i)
+            {
+                const int t = step(generator);
+                line.emplace_back(5 + t * direction.x, 7 + t * direction.y);
+            }
+            checkBackends("collinear", line, int_backends);
+        }
+
+        // Points of a square lattice, whose boundary holds collinear points between the corners
+        std::vector<Point<double>> lattice;
+        for (int i = 0; i < n; ++i)
+        {
+            lattice.emplace_back(i % 5, (i / 5) % 5);
+        }
+        std::shuffle(lattice.begin(), lattice.end(), generator);
+        checkBackends("lattice", lattice, double_backends);
+
+        // Random points in a disk
+        std::vector<Point<double>> disk;
+        std::uniform_real_distribution<double> unit(-1, 1);
+        while (static_cast<int>(disk.size()) < n)
+        {
+            const Point<double> point(unit(generator), unit(generator));
+            if (point.x * point.x + point.y * point.y <= 1)
+            {
+                disk.push_back(point);
+            }
+        }
+        checkBackends("disk", disk, double_backends);
+    }
+}
+
+/// @brief Slides windows of several widths over a stream of degenerate points, and checks the hull of every window
+/// against the batch hull of its points
+void testSlidingWindow()
+{
+    std::mt19937 generator(13);
+    std::uniform_int_distribution<int> grid_coordinate(0, 3);
+    std::uniform_int_distribution<int> step(-4, 4);
+
+    // Runs of grid points with duplicates, coinciding points and collinear points along a diagonal and an axis
+    std::vector<Point<int>> stream;
+    for (int run = 0; run < 12; ++run)
+    {
+        for (int i = 0; i < 12; ++i)
+        {
+            switch (run % 4)
+            {
+            case 0:
+                stream.emplace_back(grid_coordinate(generator), grid_coordinate(generator));
+                break;
+            case 1:
+                stream.emplace_back(2, -1);
+                break;
+            case 2: {
+                const int t = step(generator);
+                stream.emplace_back(5 + 3 * t, 7 - 2 * t);
+                break;
+            }
+            default:
+                stream.emplace_back(step(generator), 4);
+                break;
+            }
+        }
+    }
+
+    for (const std::size_t width : {1, 2, 3, 5, 16})
+    {
+        SlidingWindowConvexHull<int> window;
+        std::vector<int> hull_indices;
+        for (std::size_t i = 0; i < stream.size(); ++i)
+        {
+            window.push(stream[i], static_cast<int>(i));
+            if (window.size() > width)
+            {
+                window.pop();
+            }
+
+            const std::size_t first = (i + 1 > width) ? i + 1 - width : 0;
+            const std::vector<Point<int>> window_points(stream.begin() + first, stream.begin() + (i + 1));
+            std::vector<Point<int>> expected = constructBruteForceHull(window_points);
+            if (window_points.size() >= 3)
+            {
+                expected.clear();
+                for (const int index : constructConvexHull(window_points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN))
+                {
+                    expected.push_back(window_points[index]);
+                }
+                std::sort(expected.begin(), expected.end());
+            }
+
+            const auto orientation = (i % 2 == 0) ? Orientation::COUNTERCLOCKWISE : Orientation::CLOCKWISE;
+            const auto return_type = (i % 3 == 0) ? ConvexHullReturnType::ENCLOSED : ConvexHullReturnType::OPEN;
+            test_context = "sliding window of width " + std::to_string(width) + " at point " + std::to_string(i);
+            window.getHullIndices(hull_indices, orientation, return_type);
+            checkHull(stream, hull_indices, expected, orientation, return_type, true);
+            CHECK(window.size() == window_points.size());
+            for (const int index : hull_indices)
+            {
+                CHECK(first <= static_cast<std::size_t>(index));
+            }
+            CHECK(window.contains(stream[i]));
+        }
+    }
+}
+
+/// @brief Checks every backend on degenerate inputs already ordered along either axis, ascending or descending, which
+/// skip the sort of the monotone chain
+void testPresortedInputs()
+{
+    std::mt19937 generator(19);
+    std::uniform_int_distribution<int> grid_coordinate(0, 4);
+    const auto backends = getHullBackends<int>();
+    const std::pair<const char *, std::function<bool(const Point<int> &, const Point<int> &)>> orders[] = {
+        {"(y, x) ascending", [](const Point<int> &p1, const Point<int> &p2) { return p1 < p2; }},
+        {"(y, x) descending", [](const Point<int> &p1, const Point<int> &p2) { return p2 < p1; }},
+        {"(x, y) ascending",
+         [](const Point<int> &p1, const Point<int> &p2) { return std::tie(p1.x, p1.y) < std::tie(p2.x, p2.y); }},
+        {"(x, y) descending",
+         [](const Point<int> &p1, const Point<int> &p2) { return std::tie(p2.x, p2.y) < std::tie(p1.x, p1.y); }}};
+
+    for (int trial = 0; trial < 12; ++trial)
+    {
+        const int n = 1 + 2 * trial;
+        std::vector<Point<int>> grid, line;
+        for (int i = 0; i < n; ++i)
+        {
+            grid.emplace_back(grid_coordinate(generator), grid_coordinate(generator));
+            line.emplace_back(grid_coordinate(generator), 2);
+        }
+        for (const auto &order : orders)
+        {
+            std::stable_sort(grid.begin(), grid.end(), order.second);
+            std::stable_sort(line.begin(), line.end(), order.second);
+            checkBackends(std::string("presorted grid ") + order.first, grid, backends);
+            checkBackends(std::string("presorted line ") + order.first, line, backends);
+        }
+    }
+}
+
+/// @brief Checks Melkman's algorithm on simple polygons and polylines, among them polygons ordered by angle around the
+/// origin, zigzags, boundaries of lattices with collinear points, and runs of duplicate and collinear points
+void testMelkman()
+{
+    std::mt19937 generator(13);
+    std::uniform_real_distribution<double> unit(-1, 1);
+    std::uniform_int_distribution<int> repeats(1, 3);
+    std::vector<std::pair<std::string, std::vector<Point<double>>>> inputs;
+    for (int trial = 0; trial < 40; ++trial)
+    {
+        const int n = 3 + trial;
+        std::vector<Point<double>> polygon, zigzag, collinear;
+        for (int i = 0; i < n; ++i)
+        {
+            polygon.emplace_back(unit(generator), unit(generator));
+            zigzag.emplace_back(i, (i % 2 == 0) ? unit(generator) : 1 + unit(generator));
+
+            // Points advance along a line, repeating each point a few times
+            for (int repeat = repeats(generator); repeat > 0; --repeat)
+            {
+                collinear.emplace_back(1 + 2 * i, 3 - i);
+            }
+        }
+        std::sort(polygon.begin(), polygon.end(), [](const auto &p1, const auto &p2) {
+            return std::atan2(p1.y, p1.x) < std::atan2(p2.y, p2.x);
+        });
+        inputs.emplace_back("polygon", polygon);
+        inputs.emplace_back("zigzag", zigzag);
+        inputs.emplace_back("collinear", collinear);
+        inputs.emplace_back("coinciding", std::vector<Point<double>>(n, Point<double>(-1, 2)));
+
+        // Boundary of an m x m lattice, walked counterclockwise or clockwise from a point on an edge
+        const int m = 2 + trial % 5;
+        std::vector<Point<double>> boundary;
+        for (int i = 0; i < 4 * m; ++i)
+        {
+            const int side = i / m;
+            const int t = i % m;
+            const int x[4] = {t, m, m - t, 0};
+            const int y[4] = {0, t, m, m - t};
+            boundary.emplace_back(x[side], y[side]);
+        }
+        std::rotate(boundary.begin(), boundary.begin() + trial % boundary.size(), boundary.end());
+        if (trial % 2 == 1)
+        {
+            std::reverse(boundary.begin(), boundary.end());
+        }
+        inputs.emplace_back("lattice boundary", boundary);
+    }
+
+    for (const auto &input : inputs)
+    {
+        const auto &points = input.second;
+        const auto expected = constructBruteForceHull(points);
+        test_context = "MELKMAN " + input.first + " n=" + std::to_string(points.size());
+        for (const auto orientation : {Orientation::COUNTERCLOCKWISE, Orientation::CLOCKWISE})
+        {
+            for (const auto return_type : {ConvexHullReturnType::OPEN, ConvexHullReturnType::ENCLOSED})
+            {
+                checkHull(points, constructConvexHull(points, ConvexHullAlgorithm::MELKMAN, orientation, return_type),
+                          expected, orientation, return_type);
+            }
+        }
+    }
+}
+
+/// @brief Checks the orientation predicate on points a few ulps away from the line y = x, where the exact sign is
+/// that of y - x, and hulls of such points
+void testNearlyCollinearPoints()
+{
+#if CONVEX_HULL_ROBUST_PREDICATES
+    const double ulp = std::ldexp(1.0, -53);
+    const Point<double> q(12, 12);
+    const Point<double> r(24, 24);
+    std::vector<Point<double>> points;
+    for (int i = 0; i < 64; ++i)
+    {
+        for (int j = 0; j < 64; ++j)
+        {
+            // Cross product of (q, r) and (q, p) is 12 * (p.y - p.x) = 12 * (j - i) * ulp
+            const Point<double> p(0.5 + i * ulp, 0.5 + j * ulp);
+            const int exact_sign = (j > i) - (j < i);
+            test_context = "nearly collinear i=" + std::to_string(i) + " j=" + std::to_string(j);
+            CHECK(getOrientationSign(p, q, r) == exact_sign);
+            CHECK(getOrientationSign(q, r, p) == exact_sign);
+            CHECK(compareCrossProducts(q, r, p, Point<double>(0.5, 0.5)) == exact_sign);
+            if (i % 8 == 0 && j % 8 == 0)
+            {
+                points.push_back(p);
+            }
+        }
+    }
+
+    // Hulls of points scattered a few ulps around the line through q and r
+    points.push_back(q);
+    points.push_back(r);
+    checkBackends("nearly collinear", points, getHullBackends<double>());
+#endif
+}
+
+/// @brief Checks hulls of integer coordinates at the magnitude limits of exact cross products
+template <typename T> void testIntegerLimits(T limit)
+{
+    // Corners of the largest square, with interior points and points on its edges
+    const std::vector<Point<T>> points = {
+        {-limit, -limit}, {limit, -limit},      {0, 0},            {limit, limit},
+        {-limit, limit},  {T(-limit + 1), 3}, {1000, T(limit - 1)}, {T(limit - 2), 0},
+        {limit, 5},       {T(-limit / 2), T(-limit)}};
+    const std::vector<Point<T>> expected = {{-limit, -limit}, {limit, -limit}, {-limit, limit}, {limit, limit}};
+    for (const auto &backend : getHullBackends<T>())
+    {
+        test_context = "integer limit " + std::to_string(limit) + " " + backend.name;
+        for (const auto orientation : {Orientation::COUNTERCLOCKWISE, Orientation::CLOCKWISE})
+        {
+            checkHull(points, backend.construct(points, orientation, ConvexHullReturnType::OPEN), expected,
+                      orientation, ConvexHullReturnType::OPEN);
+        }
+    }
+}
+
+/// @brief Checks every backend on large inputs, which take the paths reserved for large inputs, against the hull of
+/// Andrew's Monotone Chain, itself checked against the brute-force hull on small inputs
+void testLargeInputs()
+{
+    std::mt19937 generator(11);
+    std::vector<Point<int>> grid;
+    std::uniform_int_distribution<int> coordinate(0, 999);
+    for (int i = 0; i < 100'000; ++i)
+    {
+        grid.emplace_back(coordinate(generator), coordinate(generator));
+    }
+
+    const auto expected_indices = constructConvexHull(grid, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN);
+    std::vector<Point<int>> expected;
+    for (const int index : expected_indices)
+    {
+        expected.push_back(grid[index]);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    for (const auto &backend : getHullBackends<int>())
+    {
+        test_context = "large integer grid " + backend.name;
+        checkHull(grid, backend.construct(grid, Orientation::CLOCKWISE, ConvexHullReturnType::ENCLOSED), expected,
+                  Orientation::CLOCKWISE, ConvexHullReturnType::ENCLOSED);
+    }
+}
+
+/// @brief Checks that radix sorted orderings match the comparison sorts they replace, on inputs above
+/// min_radix_sort_size with duplicates, signed zeros, coordinate extremes and many points at equal polar angles
+template <typename T> void testRadixSort(const std::vector<T> &coordinates)
+{
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<std::size_t> pick(0, coordinates.size() - 1);
+    std::vector<Point<T>> points;
+    for (int i = 0; i < 2 * min_radix_sort_size + 7; ++i)
+    {
+        points.emplace_back(coordinates[pick(generator)], coordinates[pick(generator)]);
+    }
+    const int n = static_cast<int>(points.size());
+    std::vector<int> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::shuffle(indices.begin(), indices.end(), generator);
+    std::vector<RadixSortItem> radix_items(2 * n);
+
+    // The monotone chain order breaks ties by index, so both sorts give the same permutation
+    test_context = "radix sort " + std::to_string(sizeof(T)) + "-byte monotone chain order";
+    auto expected = indices;
+    auto sorted = indices;
+    orderMonotoneChainRange(points, expected.data(), expected.data() + n);
+    orderMonotoneChainRange(points, sorted.data(), sorted.data() + n, radix_items.data());
+    CHECK(sorted == expected);
+
+    // Polar angles tie for collinear points, so the radix order only has to be sorted and hold every index
+    test_context = "radix sort " + std::to_string(sizeof(T)) + "-byte polar angle order";
+    const int min_index = static_cast<int>(std::min_element(points.begin(), points.end()) - points.begin());
+    sorted.clear();
+    for (const int index : indices)
+    {
+        if (index != min_index)
+        {
+            sorted.push_back(index);
+        }
+    }
+    const auto is_less = [&](int i1, int i2) { return comparePolarAngle(points[min_index], points[i1], points[i2]); };
+    const bool is_radix_sorted = sortByPseudoAngle(points, points[min_index], sorted.data(),
+                                                   sorted.data() + sorted.size(), radix_items.data());
+    CHECK(is_radix_sorted == (sizeof(T) <= sizeof(std::int32_t) || std::is_floating_point<T>::value));
+    CHECK(!is_radix_sorted || std::is_sorted(sorted.begin(), sorted.end(), is_less));
+    std::sort(sorted.begin(), sorted.end());
+    CHECK(static_cast<int>(sorted.size()) == n - 1 && std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+    // Hulls of the points, whose corners are the extreme coordinates, by every backend that sorts
+    const T low = *std::min_element(coordinates.begin(), coordinates.end());
+    const T high = *std::max_element(coordinates.begin(), coordinates.end());
+    points.emplace_back(low, low);
+    points.emplace_back(high, low);
+    points.emplace_back(high, high);
+    points.emplace_back(low, high);
+    std::vector<Point<T>> expected_hull = {{low, low}, {high, low}, {low, high}, {high, high}};
+    std::sort(expected_hull.begin(), expected_hull.end());
+    for (const auto algorithm :
+         {ConvexHullAlgorithm::GRAHAM_SCAN, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, ConvexHullAlgorithm::CHAN})
+    {
+        test_context = "radix sort " + std::to_string(sizeof(T)) + "-byte hull of algorithm " +
+                       std::to_string(static_cast<int>(algorithm));
+        checkHull(points, constructConvexHull(points, algorithm), expected_hull, Orientation::COUNTERCLOCKWISE,
+                  ConvexHullReturnType::OPEN);
+    }
+}
+
+/// @brief Checks hulls of many point sets of a batched call, split across blocks and threads, against the hull of each
+/// set on its own
+void testBatchedSets()
+{
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<int> set_size(0, 64);
+    std::uniform_int_distribution<int> coordinate(0, 9);
+
+    // Grid point sets of up to 64 points on both sides of the filter threshold, with duplicate and collinear points
+    std::vector<Point<int>> points;
+    std::vector<int> offsets = {0};
+    while (points.size() < 40'000)
+    {
+        const int n = set_size(generator);
+        for (int i = 0; i < n; ++i)
+        {
+            points.emplace_back(coordinate(generator), coordinate(generator));
+        }
+        offsets.push_back(static_cast<int>(points.size()));
+    }
+
+    PooledWorkspace<int> workspace;
+    std::vector<int> hull_indices, hull_offsets;
+    for (const int number_of_threads : {1, 4})
+    {
+        constructConvexHulls(points, offsets, hull_indices, hull_offsets, workspace, Orientation::CLOCKWISE,
+                             ConvexHullReturnType::ENCLOSED, number_of_threads);
+        test_context = "batched sets with " + std::to_string(number_of_threads) + " threads";
+        CHECK(hull_offsets.size() == offsets.size());
+        CHECK(hull_offsets.back() == static_cast<int>(hull_indices.size()));
+        for (std::size_t set_no = 0; set_no + 1 < offsets.size() && hull_offsets.size() == offsets.size(); ++set_no)
+        {
+            const std::vector<Point<int>> set_points(points.begin() + offsets[set_no],
+                                                     points.begin() + offsets[set_no + 1]);
+            std::vector<Point<int>> expected, hull;
+            for (const int index : constructConvexHull(set_points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN,
+                                                       Orientation::CLOCKWISE, ConvexHullReturnType::ENCLOSED))
+            {
+                expected.push_back(set_points[index]);
+            }
+            for (int i = hull_offsets[set_no]; i < hull_offsets[set_no + 1]; ++i)
+            {
+                CHECK(offsets[set_no] <= hull_indices[i] && hull_indices[i] < offsets[set_no + 1]);
+                hull.push_back(points[hull_indices[i]]);
+            }
+            CHECK(hull == expected);
+        }
+    }
+}
+
+/// @brief Checks streaming hulls read from a binary file, on one and several threads and after points inserted from
+/// memory, against the hull of the points in memory, and checks that missing files leave the hull unchanged
+void testStreamingFile()
+{
+    std::mt19937 generator(23);
+    std::uniform_int_distribution<int> coordinate(0, 99);
+    std::vector<Point<double>> points;
+    for (int i = 0; i < 5000; ++i)
+    {
+        points.emplace_back(coordinate(generator), coordinate(generator));
+    }
+
+    // Interleaved x and y coordinates, followed by a trailing partial point that is ignored
+    const auto path = (std::filesystem::temp_directory_path() / "test_convex_hull_stream.bin").string();
+    {
+        std::ofstream file(path, std::ios::binary);
+        for (const auto &point : points)
+        {
+            file.write(reinterpret_cast<const char *>(&point.x), sizeof(double));
+            file.write(reinterpret_cast<const char *>(&point.y), sizeof(double));
+        }
+        file.write(reinterpret_cast<const char *>(&points[0].x), sizeof(double));
+    }
+
+    std::vector<Point<double>> expected;
+    for (const int index : constructConvexHull(points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN))
+    {
+        expected.push_back(points[index]);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    for (const std::size_t chunk_size : {std::size_t(7), std::size_t(1000), std::size_t(1) << 20})
+    {
+        std::vector<std::int64_t> serial_hull;
+        for (const int number_of_threads : {1, 4})
+        {
+            test_context = "streaming file with " + std::to_string(number_of_threads) + " threads and chunks of " +
+                           std::to_string(chunk_size) + " points";
+            StreamingConvexHull<double> stream;
+            CHECK(stream.insertFile(path, chunk_size, number_of_threads));
+            CHECK(stream.size() == static_cast<std::int64_t>(points.size()));
+            const auto hull = stream.getHullIndices(Orientation::CLOCKWISE, ConvexHullReturnType::ENCLOSED);
+            checkHull(points, toIndices(hull), expected, Orientation::CLOCKWISE, ConvexHullReturnType::ENCLOSED);
+
+            // Duplicates resolve to the same stream index however the chunks are split across threads
+            if (serial_hull.empty())
+            {
+                serial_hull = hull;
+            }
+            CHECK(hull == serial_hull);
+        }
+    }
+
+    // Points read from the file continue the indices of points inserted before
+    test_context = "streaming file after points in memory";
+    StreamingConvexHull<double> stream;
+    const std::vector<Point<double>> outside = {{-1, -1}, {200, -1}, {-1, 200}};
+    stream.insert(outside);
+    CHECK(stream.insertFile(path, 1000, 4));
+    CHECK(stream.size() == static_cast<std::int64_t>(points.size() + outside.size()));
+    std::vector<Point<double>> all_points = outside;
+    all_points.insert(all_points.end(), points.begin(), points.end());
+    std::vector<Point<double>> all_expected;
+    for (const int index : constructConvexHull(all_points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN))
+    {
+        all_expected.push_back(all_points[index]);
+    }
+    std::sort(all_expected.begin(), all_expected.end());
+    checkHull(all_points, toIndices(stream.getHullIndices()), all_expected, Orientation::COUNTERCLOCKWISE,
+              ConvexHullReturnType::OPEN);
+
+    // Missing files are reported without touching the hull
+    std::filesystem::remove(path);
+    test_context = "streaming missing file";
+    const auto hull_before = stream.getHullIndices();
+    CHECK(!stream.insertFile(path, 1000, 4));
+    CHECK(stream.size() == static_cast<std::int64_t>(all_points.size()));
+    CHECK(stream.getHullIndices() == hull_before);
+}
+
+/// @brief Checks that triangles form a closed convex mesh around points: every directed edge is matched by its reverse
+/// exactly once, the mesh has Euler characteristic 2, no point lies above any triangle, and the vertices include every
+/// point of expected_vertices. An empty expected_volume skips the volume check, otherwise six times the enclosed
+/// volume must match it.
+template <typename T>
+void checkHull3(const std::vector<Point3<T>> &points, const std::vector<int> &triangles,
+                const std::vector<Point3<T>> &expected_vertices, double expected_volume = -1)
+{
+    CHECK(triangles.size() % 3 == 0 && !triangles.empty());
+    for (const int index : triangles)
+    {
+        CHECK(0 <= index && index < static_cast<int>(points.size()));
+        if (index < 0 || index >= static_cast<int>(points.size()))
+        {
+            return;
+        }
+    }
+
+    std::map<std::pair<int, int>, int> edges;
+    std::vector<int> vertices;
+    double volume = 0;
+    const int number_of_triangles = static_cast<int>(triangles.size()) / 3;
+    for (int t = 0; t < number_of_triangles; ++t)
+    {
+        const int *triangle = &triangles[3 * t];
+        CHECK(!(points[triangle[0]] == points[triangle[1]]) && !(points[triangle[1]] == points[triangle[2]]) &&
+              !(points[triangle[2]] == points[triangle[0]]));
+        for (int i = 0; i < 3; ++i)
+        {
+            ++edges[{triangle[i], triangle[(i + 1) % 3]}];
+            vertices.push_back(triangle[i]);
+        }
+        for (const auto &point : points)
+        {
+            CHECK(getOrientationSign(points[triangle[0]], points[triangle[1]], points[triangle[2]], point) <= 0);
+        }
+
+        // Signed volume of the tetrahedron of the triangle and the origin, which sums to the enclosed volume
+        const auto &a = points[triangle[0]];
+        const auto &b = points[triangle[1]];
+        const auto &c = points[triangle[2]];
+        volume += double(a.x) * (double(b.y) * c.z - double(b.z) * c.y) -
+                  double(a.y) * (double(b.x) * c.z - double(b.z) * c.x) +
+                  double(a.z) * (double(b.x) * c.y - double(b.y) * c.x);
+    }
+    for (const auto &edge : edges)
+    {
+        const auto reverse = edges.find({edge.first.second, edge.first.first});
+        CHECK(edge.second == 1 && reverse != edges.end() && reverse->second == 1);
+    }
+
+    std::sort(vertices.begin(), vertices.end());
+    vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+    CHECK(static_cast<int>(vertices.size()) - static_cast<int>(edges.size()) / 2 + number_of_triangles == 2);
+    for (const auto &expected_vertex : expected_vertices)
+    {
+        CHECK(std::any_of(vertices.begin(), vertices.end(),
+                          [&](int vertex) { return points[vertex] == expected_vertex; }));
+    }
+    if (expected_volume >= 0)
+    {
+        CHECK(volume == expected_volume);
+    }
+}
+
+/// @brief Checks 3D hulls of random, spherical, lattice and nearly coplanar points, with duplicates, and checks that
+/// coplanar, collinear and coinciding points have no hull
+void testConvexHull3()
+{
+    std::mt19937 generator(29);
+    std::uniform_real_distribution<double> unit(-1, 1);
+    std::normal_distribution<double> normal;
+    ConvexHull3Workspace<double> workspace;
+    ConvexHull3Workspace<int> int_workspace;
+    std::vector<int> triangles;
+
+    // Random points in a cube, and points on a sphere that are all hull vertices
+    for (const int n : {4, 5, 10, 100, 2000})
+    {
+        std::vector<Point3<double>> cube, sphere;
+        for (int i = 0; i < n; ++i)
+        {
+            cube.emplace_back(unit(generator), unit(generator), unit(generator));
+            const double x = normal(generator), y = normal(generator), z = normal(generator);
+            const double length = std::sqrt(x * x + y * y + z * z);
+            sphere.emplace_back(x / length, y / length, z / length);
+        }
+        test_context = "3D cube n=" + std::to_string(n);
+        constructConvexHull3(cube, triangles, workspace);
+        checkHull3(cube, triangles, {});
+        test_context = "3D sphere n=" + std::to_string(n);
+        constructConvexHull3(sphere, triangles, workspace);
+        checkHull3(sphere, triangles, sphere);
+    }
+
+    // Lattice points of a cube, whose flat facets hold collinear and coplanar points, and whose volume is exact
+    for (const int m : {1, 2, 4})
+    {
+        std::vector<Point3<int>> lattice;
+        for (int x = 0; x <= m; ++x)
+        {
+            for (int y = 0; y <= m; ++y)
+            {
+                for (int z = 0; z <= m; ++z)
+                {
+                    lattice.emplace_back(x, y, z);
+                }
+            }
+        }
+        std::shuffle(lattice.begin(), lattice.end(), generator);
+        const std::vector<Point3<int>> corners = {{0, 0, 0}, {m, 0, 0}, {0, m, 0}, {m, m, 0},
+                                                  {0, 0, m}, {m, 0, m}, {0, m, m}, {m, m, m}};
+        test_context = "3D lattice m=" + std::to_string(m);
+        constructConvexHull3(lattice, triangles, int_workspace);
+        checkHull3(lattice, triangles, corners, 6.0 * m * m * m);
+
+        // Every corner repeated three times, among interior points
+        std::vector<Point3<int>> duplicates;
+        for (int repeat = 0; repeat < 3; ++repeat)
+        {
+            duplicates.insert(duplicates.end(), corners.begin(), corners.end());
+            duplicates.emplace_back(m / 2, m / 2, (m + 1) / 2);
+        }
+        std::shuffle(duplicates.begin(), duplicates.end(), generator);
+        test_context = "3D duplicate corners m=" + std::to_string(m);
+        constructConvexHull3(duplicates, triangles, int_workspace);
+        checkHull3(duplicates, triangles, corners, 6.0 * m * m * m);
+        CHECK(triangles.size() == 12 * 3);
+    }
+
+    // Points a few ulps off a tilted plane, with one point far above it
+    std::vector<Point3<double>> nearly_coplanar;
+    for (int i = 0; i < 200; ++i)
+    {
+        const double x = unit(generator), y = unit(generator);
+        const double z = 0.1 * x + 0.3 * y;
+        nearly_coplanar.emplace_back(x, y, z + (i % 3 - 1) * std::numeric_limits<double>::epsilon() * std::abs(z));
+    }
+    nearly_coplanar.emplace_back(0, 0, 1);
+    test_context = "3D nearly coplanar";
+    constructConvexHull3(nearly_coplanar, triangles, workspace);
+    checkHull3(nearly_coplanar, triangles, {Point3<double>(0, 0, 1)});
+
+    // Degenerate inputs span no volume, and have no hull
+    std::vector<std::pair<std::string, std::vector<Point3<int>>>> degenerate_inputs = {
+        {"empty", {}},
+        {"three points", {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}},
+        {"coinciding", std::vector<Point3<int>>(10, Point3<int>(3, -1, 2))}};
+    std::vector<Point3<int>> plane, line;
+    std::uniform_int_distribution<int> coordinate(-5, 5);
+    for (int i = 0; i < 50; ++i)
+    {
+        const int x = coordinate(generator), y = coordinate(generator);
+        plane.emplace_back(x, y, 2 * x - 3 * y + 1);
+        line.emplace_back(x, 2 * x + 1, -x);
+    }
+    degenerate_inputs.emplace_back("coplanar", plane);
+    degenerate_inputs.emplace_back("collinear", line);
+    for (const auto &input : degenerate_inputs)
+    {
+        test_context = "3D " + input.first;
+        constructConvexHull3(input.second, triangles, int_workspace);
+        CHECK(triangles.empty());
+    }
+}
+
+/// @brief Checks the algorithms AUTO selects for ordered, filled and convex position inputs, and that thresholds
+/// calibrated on the running machine give the same hull
+void testAutoSelection()
+{
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> unit(-1, 1);
+    std::vector<Point<double>> disk;
+    std::vector<Point<double>> circle;
+    while (disk.size() < 100000)
+    {
+        const Point<double> p(unit(generator), unit(generator));
+        if (p.x * p.x + p.y * p.y <= 1)
+        {
+            disk.push_back(p);
+            circle.emplace_back(std::cos(4 * p.x), std::sin(4 * p.x));
+        }
+    }
+    auto sorted = disk;
+    std::sort(sorted.begin(), sorted.end(), [](const Point<double> &p1, const Point<double> &p2) {
+        return p1.x < p2.x || (p1.x == p2.x && p1.y < p2.y);
+    });
+    const auto is_serial = [](ConvexHullAlgorithm algorithm, ConvexHullAlgorithm serial_algorithm) {
+        return algorithm == serial_algorithm || algorithm == getParallelConvexHullAlgorithm(serial_algorithm);
+    };
+
+    test_context = "AUTO small input";
+    auto selection = selectConvexHullAlgorithm(std::vector<Point<double>>(disk.begin(), disk.begin() + 100));
+    CHECK(selection.algorithm == ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN);
+    CHECK(selection.filter == ConvexHullFilter::NONE);
+
+    test_context = "AUTO presorted input";
+    selection = selectConvexHullAlgorithm(sorted);
+    CHECK(is_serial(selection.algorithm, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN));
+    CHECK(selection.filter == ConvexHullFilter::NONE);
+
+    test_context = "AUTO filled disk";
+    selection = selectConvexHullAlgorithm(disk);
+    CHECK(is_serial(selection.algorithm, ConvexHullAlgorithm::QUICKHULL));
+    CHECK(selection.filter == ConvexHullFilter::OCTAGON);
+    CHECK(selection.survivor_fraction < 0.2);
+
+    test_context = "AUTO circle";
+    selection = selectConvexHullAlgorithm(circle);
+    CHECK(is_serial(selection.algorithm, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN));
+    CHECK(selection.filter == ConvexHullFilter::NONE);
+    CHECK(selection.survivor_fraction == 1);
+
+    // Calibration over small sizes only, which skips the parallel sweep
+    test_context = "AUTO calibration";
+    const auto thresholds = calibrateConvexHullAutoThresholds(1 << 12, 1);
+    CHECK(thresholds.max_small_size >= 8 && thresholds.max_small_size <= 1 << 10);
+    CHECK(thresholds.min_filter_size >= 16);
+    CHECK(thresholds.min_parallel_size >= ConvexHullAutoThresholds().min_parallel_size);
+    ConvexHullWorkspace<double> workspace;
+    workspace.auto_thresholds = thresholds;
+    for (const auto *points : {&disk, &circle, &sorted})
+    {
+        std::vector<int> hull_indices;
+        constructConvexHull(*points, hull_indices, workspace, ConvexHullAlgorithm::AUTO);
+        auto expected = constructConvexHull(*points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN);
+        CHECK(std::is_permutation(hull_indices.begin(), hull_indices.end(), expected.begin(), expected.end()));
+    }
+}
+
+/// @brief Checks containment, tangent and extreme vertex queries of ConvexPolygon against linear scans over the
+/// vertices, for polygons built from hulls of either orientation and return type
+template <typename T> void checkConvexPolygon(const std::string &name, const std::vector<Point<T>> &points,
+                                              const std::vector<Point<T>> &queries)
+{
+    std::vector<std::uint8_t> is_inside;
+    std::vector<std::uint8_t> is_inside_array;
+    for (const auto orientation : {Orientation::COUNTERCLOCKWISE, Orientation::CLOCKWISE})
+    {
+        for (const auto return_type : {ConvexHullReturnType::OPEN, ConvexHullReturnType::ENCLOSED})
+        {
+            test_context = "ConvexPolygon " + name + " orientation " + std::to_string(static_cast<int>(orientation)) +
+                           " return type " + std::to_string(static_cast<int>(return_type));
+            const auto hull_indices = constructConvexHull(points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN,
+                                                          orientation, return_type);
+            const ConvexPolygon<T> polygon(points, hull_indices);
+            const int h = polygon.size();
+            CHECK(h == static_cast<int>(hull_indices.size()) - (return_type == ConvexHullReturnType::ENCLOSED));
+            for (int i = 0; i < h; ++i)
+            {
+                CHECK(polygon.getVertex(i) == points[polygon.getIndex(i)]);
+                CHECK(std::count(hull_indices.begin(), hull_indices.end(), polygon.getIndex(i)) >= 1);
+                CHECK(h < 3 || getOrientationSign(polygon.getVertex(i), polygon.getVertex((i + 1) % h),
+                                                  polygon.getVertex((i + 2) % h)) > 0);
+            }
+
+            polygon.contains(queries, is_inside);
+            polygon.contains(PointArray<T>(queries), is_inside_array);
+            CHECK(is_inside == is_inside_array);
+            for (std::size_t q = 0; q < queries.size(); ++q)
+            {
+                const auto &point = queries[q];
+                bool is_expected_inside = h > 0;
+                for (int i = 0; i < h && is_expected_inside; ++i)
+                {
+                    // Polygons of fewer than 3 vertices contain the points of their segment
+                    const auto &a = polygon.getVertex(i);
+                    const auto &b = polygon.getVertex((i + 1) % h);
+                    is_expected_inside = (h >= 3) ? getOrientationSign(a, b, point) >= 0
+                                                  : getOrientationSign(a, b, point) == 0 &&
+                                                        std::min(a.x, b.x) <= point.x && point.x <= std::max(a.x, b.x) &&
+                                                        std::min(a.y, b.y) <= point.y && point.y <= std::max(a.y, b.y);
+                }
+                CHECK(polygon.contains(point) == is_expected_inside);
+                CHECK(static_cast<bool>(is_inside[q]) == is_expected_inside);
+
+                // No vertex lies right of the ray to the right tangent or left of the ray to the left tangent, and
+                // vertices collinear with a tangent ray are not farther than the tangent vertex
+                int right_tangent = -1;
+                int left_tangent = -1;
+                CHECK(polygon.findTangents(point, right_tangent, left_tangent) == !is_expected_inside);
+                if (is_expected_inside)
+                {
+                    continue;
+                }
+                const auto getSquaredDistance = [&](int i) {
+                    const T dx = polygon.getVertex(i).x - point.x;
+                    const T dy = polygon.getVertex(i).y - point.y;
+                    return dx * dx + dy * dy;
+                };
+                for (int i = 0; i < h; ++i)
+                {
+                    const int right_sign = getOrientationSign(point, polygon.getVertex(right_tangent),
+                                                              polygon.getVertex(i));
+                    const int left_sign = getOrientationSign(point, polygon.getVertex(left_tangent),
+                                                             polygon.getVertex(i));
+                    CHECK(right_sign > 0 ||
+                          (right_sign == 0 && getSquaredDistance(i) <= getSquaredDistance(right_tangent)));
+                    CHECK(left_sign < 0 ||
+                          (left_sign == 0 && getSquaredDistance(i) <= getSquaredDistance(left_tangent)));
+                }
+            }
+
+            // The extreme vertex maximizes the dot product, and is the first counterclockwise of an edge
+            // perpendicular to the direction
+            for (const auto &direction : queries)
+            {
+                const int extreme = polygon.findExtremeVertex(direction);
+                const auto dot = [&](int i) {
+                    return direction.x * polygon.getVertex(i).x + direction.y * polygon.getVertex(i).y;
+                };
+                CHECK(0 <= extreme && extreme < h);
+                for (int i = 0; i < h; ++i)
+                {
+                    CHECK(dot(i) <= dot(extreme));
+                }
+                CHECK(h < 3 || direction == Point<T>(0, 0) || dot((extreme + h - 1) % h) < dot(extreme));
+            }
+        }
+    }
+}
+
+/// @brief Checks ConvexPolygon queries on polygons with many, few and collinear vertices
+void testConvexPolygon()
+{
+    // Lattice points in a disk, whose hulls have many edges with lattice points on them, queried on a finer lattice
+    // that covers every vertex, edge and the surroundings of the polygon
+    std::mt19937 generator(23);
+    for (const int radius : {1, 3, 40})
+    {
+        std::vector<Point<int>> points;
+        std::uniform_int_distribution<int> coordinate(-radius, radius);
+        for (int i = 0; i < 50 * radius; ++i)
+        {
+            const Point<int> p(coordinate(generator), coordinate(generator));
+            if (p.x * p.x + p.y * p.y <= radius * radius)
+            {
+                points.push_back(p);
+            }
+        }
+        std::vector<Point<int>> queries;
+        for (int x = -radius - 2; x <= radius + 2; ++x)
+        {
+            for (int y = -radius - 2; y <= radius + 2; ++y)
+            {
+                queries.emplace_back(x, y);
+            }
+        }
+        checkConvexPolygon("lattice disk radius " + std::to_string(radius), points, queries);
+    }
+
+    // Floating-point points on a circle, queried at random positions and at the vertices
+    std::uniform_real_distribution<double> unit(-1.5, 1.5);
+    for (const int n : {3, 4, 17, 500})
+    {
+        std::vector<Point<double>> points;
+        for (int i = 0; i < n; ++i)
+        {
+            const double angle = 2 * std::acos(-1.0) * (i + 0.5 * unit(generator) / 1.5) / n;
+            points.emplace_back(std::cos(angle), std::sin(angle));
+        }
+        auto queries = points;
+        for (int i = 0; i < 300; ++i)
+        {
+            queries.emplace_back(unit(generator), unit(generator));
+        }
+        checkConvexPolygon("circle n=" + std::to_string(n), points, queries);
+    }
+
+    // Degenerate hulls: a segment and no points
+    const std::vector<Point<int>> queries = {{0, 0}, {1, 1}, {2, 2}, {3, 3}, {1, 2}, {-1, -1}};
+    checkConvexPolygon("segment", std::vector<Point<int>>{{0, 0}, {2, 2}, {1, 1}}, queries);
+    test_context = "ConvexPolygon empty";
+    const ConvexPolygon<int> polygon(std::vector<Point<int>>{}, std::vector<int>{});
+    int right_tangent = -1;
+    int left_tangent = -1;
+    CHECK(polygon.size() == 0 && !polygon.contains(Point<int>(0, 0)));
+    CHECK(!polygon.findTangents(Point<int>(0, 0), right_tangent, left_tangent));
+    CHECK(polygon.findExtremeVertex(Point<int>(1, 0)) == -1);
+}
+
+/// @brief Checks the rotating calipers against brute force over every pair of points and every hull edge, for hulls
+/// of both orientations and return types
+template <typename T> void checkHullGeometry(const std::string &name, const std::vector<Point<T>> &points)
+{
+    using R = Real<T>;
+    const auto is_close = [](R a, R b) { return std::abs(a - b) <= 1e-9 * std::max<R>(1, std::abs(b)); };
+    for (const auto orientation : {Orientation::COUNTERCLOCKWISE, Orientation::CLOCKWISE})
+    {
+        for (const auto return_type : {ConvexHullReturnType::OPEN, ConvexHullReturnType::ENCLOSED})
+        {
+            test_context = "hull geometry " + name + " orientation " + std::to_string(static_cast<int>(orientation)) +
+                           " return type " + std::to_string(static_cast<int>(return_type));
+            const auto hull_indices = constructConvexHull(points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN,
+                                                          orientation, return_type);
+            const ConvexPolygon<T> polygon(points, hull_indices);
+            const int h = polygon.size();
+
+            // The diameter is the farthest pair of all points
+            Accumulator<T> expected_squared_distance = 0;
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                for (std::size_t j = i + 1; j < points.size(); ++j)
+                {
+                    expected_squared_distance =
+                        std::max(expected_squared_distance, squaredDistance<T>(points[i], points[j]));
+                }
+            }
+            const auto diameter = findHullDiameter(points, hull_indices);
+            CHECK(diameter.squared_distance == expected_squared_distance);
+            CHECK(points.empty() ||
+                  squaredDistance<T>(points[diameter.first], points[diameter.second]) == diameter.squared_distance);
+
+            // Width and box are minimized over the hull edges, measuring the extents of all points along each edge
+            R expected_width = 0;
+            R expected_area = 0;
+            for (int i = 0; i < h && h >= 3; ++i)
+            {
+                const auto &origin = polygon.getVertex(i);
+                const auto &next = polygon.getVertex((i + 1) % h);
+                const R length = std::hypot(R(next.x) - R(origin.x), R(next.y) - R(origin.y));
+                R minimum = 0, maximum = 0, height = 0;
+                for (const auto &point : points)
+                {
+                    const R along = ((R(point.x) - R(origin.x)) * (R(next.x) - R(origin.x)) +
+                                     (R(point.y) - R(origin.y)) * (R(next.y) - R(origin.y))) /
+                                    length;
+                    minimum = std::min(minimum, along);
+                    maximum = std::max(maximum, along);
+                    height = std::max(height, R(crossProduct<T>(origin, next, point)) / length);
+                }
+                const R area = (maximum - minimum) * height;
+                expected_width = (i == 0) ? height : std::min(expected_width, height);
+                expected_area = (i == 0) ? area : std::min(expected_area, area);
+            }
+
+            const auto width = findHullWidth(points, hull_indices);
+            CHECK(is_close(width.width, expected_width));
+            if (h >= 3)
+            {
+                // The width is attained between a hull edge and a vertex
+                bool is_edge = false;
+                for (int i = 0; i < h; ++i)
+                {
+                    is_edge |= polygon.getIndex(i) == width.edge_first &&
+                               polygon.getIndex((i + 1) % h) == width.edge_second;
+                }
+                CHECK(is_edge);
+                const auto &origin = points[width.edge_first];
+                const auto &next = points[width.edge_second];
+                CHECK(is_close(R(crossProduct<T>(origin, next, points[width.vertex])) /
+                                   std::hypot(R(next.x) - R(origin.x), R(next.y) - R(origin.y)),
+                               width.width));
+            }
+
+            // The box is a counterclockwise rectangle of the reported sides, which encloses every point
+            const auto box = findMinimumAreaBoundingBox(points, hull_indices);
+            CHECK(is_close(box.area, expected_area));
+            CHECK(is_close(box.width * box.height, box.area));
+            const auto &corners = box.corners;
+            const R scale = std::max<R>(1, std::sqrt(R(diameter.squared_distance)));
+            for (int c = 0; c < 4 && !points.empty(); ++c)
+            {
+                const auto &a = corners[c];
+                const auto &b = corners[(c + 1) % 4];
+                const auto &d = corners[(c + 3) % 4];
+                const R side = std::hypot(b.x - a.x, b.y - a.y);
+                CHECK(is_close(side, (c % 2 == 0) ? box.width : box.height));
+                CHECK(std::abs((b.x - a.x) * (d.x - a.x) + (b.y - a.y) * (d.y - a.y)) <= 1e-9 * scale * scale);
+                for (const auto &point : points)
+                {
+                    CHECK((b.x - a.x) * (R(point.y) - a.y) - (b.y - a.y) * (R(point.x) - a.x) >=
+                          -1e-9 * scale * scale);
+                }
+            }
+        }
+    }
+}
+
+/// @brief Checks diameter, width and bounding box on lattice and floating-point hulls and degenerate inputs, and the
+/// geometries returned by the batched construction
+void testHullGeometry()
+{
+    std::mt19937 generator(29);
+    for (const int size : {2, 5, 1000})
+    {
+        std::uniform_int_distribution<int> coordinate(-size, size);
+        std::vector<Point<int>> points;
+        for (int i = 0; i < 60; ++i)
+        {
+            points.emplace_back(coordinate(generator), coordinate(generator) / 3);
+        }
+        checkHullGeometry("lattice size " + std::to_string(size), points);
+    }
+
+    // Rotated rectangle with interior points, whose minimum box is the rectangle itself
+    std::uniform_real_distribution<double> unit(0, 1);
+    std::vector<Point<double>> rectangle;
+    const double angle = 0.3;
+    for (int i = 0; i < 200; ++i)
+    {
+        const double u = (i < 4) ? (i & 1) * 4.0 : 4 * unit(generator);
+        const double v = (i < 4) ? (i >> 1) * 1.5 : 1.5 * unit(generator);
+        rectangle.emplace_back(u * std::cos(angle) - v * std::sin(angle), u * std::sin(angle) + v * std::cos(angle));
+    }
+    checkHullGeometry("rotated rectangle", rectangle);
+    test_context = "hull geometry rotated rectangle";
+    const auto rectangle_hull = constructConvexHull(rectangle);
+    CHECK(std::abs(findMinimumAreaBoundingBox(rectangle, rectangle_hull).area - 6) < 1e-9);
+    CHECK(std::abs(findHullWidth(rectangle, rectangle_hull).width - 1.5) < 1e-9);
+    CHECK(std::abs(findHullDiameter(rectangle, rectangle_hull).squared_distance - 18.25) < 1e-9);
+
+    std::vector<Point<double>> circle;
+    for (int i = 0; i < 101; ++i)
+    {
+        const double a = 2 * std::acos(-1.0) * (i + 0.4 * unit(generator)) / 101;
+        circle.emplace_back(3 * std::cos(a), std::sin(a));
+    }
+    checkHullGeometry("ellipse", circle);
+
+    // Degenerate hulls: no points, one point, coinciding points and collinear points
+    checkHullGeometry("empty", std::vector<Point<int>>{});
+    checkHullGeometry("single point", std::vector<Point<int>>{{3, 4}});
+    checkHullGeometry("coinciding points", std::vector<Point<int>>{{3, 4}, {3, 4}, {3, 4}});
+    checkHullGeometry("collinear points", std::vector<Point<int>>{{0, 0}, {3, 6}, {1, 2}, {2, 4}});
+    test_context = "hull geometry collinear points";
+    const std::vector<Point<int>> segment = {{0, 0}, {3, 6}, {1, 2}};
+    const auto segment_hull = constructConvexHull(segment);
+    CHECK(findHullDiameter(segment, segment_hull).squared_distance == 45);
+    CHECK(findHullWidth(segment, segment_hull).width == 0);
+    CHECK(std::abs(findMinimumAreaBoundingBox(segment, segment_hull).width - std::sqrt(45.0)) < 1e-12);
+
+    // Batched geometries match the geometry of each hull computed on its own
+    std::vector<Point<int>> points;
+    std::vector<int> offsets = {0};
+    std::uniform_int_distribution<int> set_size(0, 64);
+    std::uniform_int_distribution<int> coordinate(-20, 20);
+    for (int set_no = 0; set_no < 300; ++set_no)
+    {
+        const int n = set_size(generator);
+        for (int i = 0; i < n; ++i)
+        {
+            points.emplace_back(coordinate(generator), coordinate(generator));
+        }
+        offsets.push_back(static_cast<int>(points.size()));
+    }
+    std::vector<int> hull_indices, hull_offsets;
+    std::vector<HullGeometry<int>> geometries;
+    for (const int number_of_threads : {1, 4})
+    {
+        test_context = "batched hull geometry with " + std::to_string(number_of_threads) + " threads";
+        constructConvexHulls(points, offsets, hull_indices, hull_offsets, geometries, Orientation::CLOCKWISE,
+                             ConvexHullReturnType::ENCLOSED, number_of_threads);
+        CHECK(geometries.size() + 1 == offsets.size());
+        for (std::size_t set_no = 0; set_no < geometries.size(); ++set_no)
+        {
+            const std::vector<int> set_hull(hull_indices.begin() + hull_offsets[set_no],
+                                            hull_indices.begin() + hull_offsets[set_no + 1]);
+            const auto &geometry = geometries[set_no];
+            CHECK(geometry.diameter.squared_distance == findHullDiameter(points, set_hull).squared_distance);
+            CHECK(geometry.width.width == findHullWidth(points, set_hull).width);
+            CHECK(geometry.bounding_box.area == findMinimumAreaBoundingBox(points, set_hull).area);
+        }
+    }
+}
+
+/// @brief Returns the distance from a point to the convex polygon of counterclockwise vertices, 0 inside it
+template <typename T> double getDistanceToPolygon(const std::vector<Point<T>> &vertices, const Point<T> &point)
+{
+    const int h = static_cast<int>(vertices.size());
+    bool is_inside = h >= 3;
+    double distance = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < h; ++i)
+    {
+        const auto &a = vertices[i];
+        const auto &b = vertices[(i + 1) % h];
+        is_inside = is_inside && getOrientationSign(a, b, point) >= 0;
+        const double dx = double(b.x) - double(a.x);
+        const double dy = double(b.y) - double(a.y);
+        const double px = double(point.x) - double(a.x);
+        const double py = double(point.y) - double(a.y);
+        const double length = dx * dx + dy * dy;
+        const double t = (length > 0) ? std::clamp((px * dx + py * dy) / length, 0.0, 1.0) : 0.0;
+        distance = std::min(distance, std::hypot(px - t * dx, py - t * dy));
+    }
+    return is_inside ? 0 : distance;
+}
+
+/// @brief Checks that approximate hulls are convex polygons of input points, which contain every point up to the
+/// reported error, and that the error is about the strip width
+template <typename T> void checkApproximateHull(const std::string &name, const std::vector<Point<T>> &points)
+{
+    const int n = static_cast<int>(points.size());
+    double min_x = 0, max_x = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        min_x = (i == 0) ? double(points[i].x) : std::min(min_x, double(points[i].x));
+        max_x = (i == 0) ? double(points[i].x) : std::max(max_x, double(points[i].x));
+    }
+
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> hull_indices;
+    for (const int number_of_strips : {1, 3, 64, 1 << 10})
+    {
+        for (const auto filter : {ConvexHullFilter::NONE, ConvexHullFilter::OCTAGON})
+        {
+            test_context = "approximate " + name + " n=" + std::to_string(n) + " strips " +
+                           std::to_string(number_of_strips) + " filter " + std::to_string(static_cast<int>(filter));
+            workspace.approximation_strips = number_of_strips;
+            constructConvexHull(points, hull_indices, workspace, ConvexHullAlgorithm::APPROXIMATE,
+                                Orientation::COUNTERCLOCKWISE, ConvexHullReturnType::OPEN, filter);
+            const double error = workspace.approximation_error;
+            if (n < 3)
+            {
+                CHECK(hull_indices.empty() && error == 0);
+                continue;
+            }
+
+            // The hull is a strictly convex counterclockwise polygon of distinct input points
+            std::vector<Point<T>> vertices;
+            for (const int index : hull_indices)
+            {
+                CHECK(0 <= index && index < n);
+                vertices.push_back(points[std::clamp(index, 0, n - 1)]);
+            }
+            const int h = static_cast<int>(vertices.size());
+            CHECK(h >= 1);
+            for (int i = 0; h >= 3 && i < h; ++i)
+            {
+                CHECK(getOrientationSign(vertices[i], vertices[(i + 1) % h], vertices[(i + 2) % h]) > 0);
+            }
+
+            // Every point is within the error of the hull, and the error is at most the strip width, up to rounding.
+            // Filtered inputs are cut into strips as wide as those of their survivors.
+            const int strips = (filter == ConvexHullFilter::NONE) ? std::min(number_of_strips, n) : 1;
+            CHECK(0 <= error && error <= (max_x - min_x) / strips * (1 + 1e-9));
+            for (const auto &point : points)
+            {
+                CHECK(getDistanceToPolygon(vertices, point) <= error * (1 + 1e-12) + 1e-12 * (max_x - min_x));
+            }
+
+            // The value wrapper returns the same hull and bound
+            if (filter == ConvexHullFilter::NONE)
+            {
+                Real<T> wrapper_error = -1;
+                const auto wrapper_hull = constructApproximateConvexHull(points, Orientation::COUNTERCLOCKWISE,
+                                                                         ConvexHullReturnType::OPEN, wrapper_error,
+                                                                         number_of_strips);
+                CHECK(wrapper_hull == hull_indices && wrapper_error == workspace.approximation_error);
+            }
+        }
+    }
+
+    // Other orientations and return types follow the conventions of the exact backends
+    test_context = "approximate " + name + " orientation and return type";
+    constructConvexHull(points, hull_indices, workspace, ConvexHullAlgorithm::APPROXIMATE, Orientation::CLOCKWISE,
+                        ConvexHullReturnType::ENCLOSED);
+    CHECK(n < 3 || (hull_indices.size() >= 2 && hull_indices.front() == hull_indices.back()));
+    for (std::size_t i = 0; i + 3 < hull_indices.size(); ++i)
+    {
+        CHECK(getOrientationSign(points[hull_indices[i]], points[hull_indices[i + 1]], points[hull_indices[i + 2]]) <
+              0);
+    }
+}
+
+/// @brief Checks approximate hulls and their error bound on random, circular, lattice and degenerate inputs
+void testApproximateHull()
+{
+    std::mt19937 generator(31);
+    std::uniform_real_distribution<double> unit(-1, 1);
+    std::normal_distribution<double> normal(0, 1);
+    std::vector<Point<double>> square, disk, circle, gaussian;
+    for (int i = 0; i < 5000; ++i)
+    {
+        square.emplace_back(1000 * unit(generator), 1000 * unit(generator));
+        const double angle = std::acos(-1.0) * unit(generator);
+        const double radius = std::sqrt(0.5 + 0.5 * unit(generator));
+        disk.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+        circle.emplace_back(std::cos(angle), std::sin(angle));
+        gaussian.emplace_back(normal(generator), 1e-3 * normal(generator));
+    }
+    checkApproximateHull("square", square);
+    checkApproximateHull("disk", disk);
+    checkApproximateHull("circle", circle);
+    checkApproximateHull("flat gaussian", gaussian);
+
+    std::vector<Point<int>> grid, vertical, collinear;
+    std::uniform_int_distribution<int> coordinate(-50, 50);
+    for (int i = 0; i < 3000; ++i)
+    {
+        grid.emplace_back(coordinate(generator), coordinate(generator));
+        vertical.emplace_back(7, coordinate(generator));
+        const int t = coordinate(generator);
+        collinear.emplace_back(t, 2 * t + 1);
+    }
+    checkApproximateHull("integer grid", grid);
+    checkApproximateHull("vertical segment", vertical);
+    checkApproximateHull("collinear", collinear);
+    checkApproximateHull("coinciding", std::vector<Point<int>>(10, Point<int>(3, -4)));
+    checkApproximateHull("triangle", std::vector<Point<int>>{{0, 0}, {4, 0}, {0, 4}});
+    checkApproximateHull("two points", std::vector<Point<int>>{{0, 0}, {4, 0}});
+    checkApproximateHull("empty", std::vector<Point<int>>{});
+
+    // Lattice points with distinct x coordinates, one per strip, so that the error bound is 0 and the hull is exact
+    test_context = "approximate exact strips";
+    std::vector<Point<int>> parabola;
+    for (int x = -20; x <= 20; ++x)
+    {
+        parabola.emplace_back(x, x * x);
+    }
+    Real<int> error = -1;
+    const auto hull_indices = constructApproximateConvexHull(parabola, Orientation::COUNTERCLOCKWISE,
+                                                             ConvexHullReturnType::OPEN, error, 41);
+    CHECK(error == 0);
+    CHECK(hull_indices.size() == parabola.size());
+}
+
+/// @brief Checks the hull of a fixed-size copy of points against the brute-force hull, in both orientations and return
+/// types
+template <typename T, std::size_t N> void checkFixedHull(const std::string &name, const std::vector<Point<T>> &points)
+{
+    std::array<Point<T>, N> fixed_points;
+    std::copy(points.begin(), points.end(), fixed_points.begin());
+    const auto expected = constructBruteForceHull(points);
+    for (const auto orientation : {Orientation::COUNTERCLOCKWISE, Orientation::CLOCKWISE})
+    {
+        for (const auto return_type : {ConvexHullReturnType::OPEN, ConvexHullReturnType::ENCLOSED})
+        {
+            test_context = "fixed " + name + " N=" + std::to_string(N);
+            const auto hull_indices = constructConvexHull(fixed_points, orientation, return_type);
+            CHECK(hull_indices.size() <= hull_indices.capacity());
+            checkHull(points, hull_indices, expected, orientation, return_type);
+        }
+    }
+}
+
+/// @brief Checks fixed-size hulls of N random, grid, collinear and coinciding points
+template <std::size_t N> void checkFixedHulls(std::mt19937 &generator)
+{
+    std::uniform_real_distribution<double> unit(-1, 1);
+    std::uniform_int_distribution<int> grid_coordinate(0, 3);
+    std::uniform_int_distribution<int> step(-4, 4);
+    for (int trial = 0; trial < 20; ++trial)
+    {
+        std::vector<Point<double>> disk;
+        std::vector<Point<long double>> long_disk;
+        std::vector<Point<float>> circle;
+        std::vector<Point<int>> grid, line;
+        std::vector<Point<std::int64_t>> wide;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            const double angle = std::acos(-1.0) * unit(generator);
+            const double radius = std::sqrt(0.5 + 0.5 * unit(generator));
+            disk.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+            long_disk.emplace_back(disk.back().x, disk.back().y);
+            circle.emplace_back(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+            grid.emplace_back(grid_coordinate(generator), grid_coordinate(generator));
+            const int t = step(generator);
+            line.emplace_back(5 + 3 * t, 7 - 2 * t);
+            wide.emplace_back(std::int64_t(grid_coordinate(generator)) << 60, std::int64_t(t) << 58);
+        }
+        checkFixedHull<double, N>("disk", disk);
+        checkFixedHull<long double, N>("long double disk", long_disk);
+        checkFixedHull<float, N>("circle", circle);
+        checkFixedHull<int, N>("integer grid", grid);
+        checkFixedHull<int, N>("collinear", line);
+        checkFixedHull<std::int64_t, N>("int64 grid", wide);
+    }
+    checkFixedHull<double, N>("coinciding", std::vector<Point<double>>(N, Point<double>(1.5, -2)));
+
+    // Coordinates that differ only in their lowest bits, which the sort keys drop to make room for positions
+    std::vector<Point<double>> close;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const double y = 1 + std::numeric_limits<double>::epsilon() * static_cast<double>((i * 7) % N);
+        close.emplace_back(i % 2 == 0 ? 0.0 : 1.0, y);
+    }
+    checkFixedHull<double, N>("close coordinates", close);
+}
+
+/// @brief Checks the sorting network on every 0-1 input, which suffices for it to sort any input, and the fixed-size
+/// hulls against the brute-force hull
+void testFixedSizeSets()
+{
+    for (int n = 1; n <= 14; ++n)
+    {
+        test_context = "sorting network of " + std::to_string(n) + " items";
+        bool is_sorted = true;
+        for (int input = 0; input < (1 << n); ++input)
+        {
+            int bits = input;
+            forEachSortingNetworkExchange(n, [&](int i, int j) {
+                const int bit_i = (bits >> i) & 1;
+                const int bit_j = (bits >> j) & 1;
+                bits ^= (bit_i & ~bit_j) * ((1 << i) | (1 << j));
+            });
+            const int zeros = ~bits & ((1 << n) - 1);
+            is_sorted = is_sorted && (zeros & (zeros + 1)) == 0;
+        }
+        CHECK(is_sorted);
+    }
+    CHECK(sorting_network<32>.size() == 191);
+
+    std::mt19937 generator(37);
+    checkFixedHulls<3>(generator);
+    checkFixedHulls<4>(generator);
+    checkFixedHulls<5>(generator);
+    checkFixedHulls<8>(generator);
+    checkFixedHulls<13>(generator);
+    checkFixedHulls<16>(generator);
+    checkFixedHulls<32>(generator);
+
+    // Fewer than 3 points and Orientation::COLLINEAR have an empty hull
+    test_context = "fixed small sets";
+    CHECK(constructConvexHull(std::array<Point<int>, 2>{{{0, 0}, {1, 1}}}).empty());
+    CHECK(constructConvexHull(std::array<Point<int>, 3>{{{0, 0}, {1, 0}, {0, 1}}}, Orientation::COLLINEAR).empty());
+}
+
+/// @brief Returns the expected vertices of the hull of the union of hulls, which is the brute-force hull of their
+/// vertices
+template <typename T>
+std::vector<Point<T>> getMergedHullVertices(const std::vector<Point<T>> &points,
+                                            const std::vector<std::vector<int>> &hulls)
+{
+    std::vector<Point<T>> vertices;
+    for (const auto &hull : hulls)
+    {
+        for (const int index : hull)
+        {
+            vertices.push_back(points[index]);
+        }
+    }
+    return constructBruteForceHull(vertices);
+}
+
+/// @brief Checks a merged hull like checkHull, where hulls without vertices merge into an empty hull
+template <typename T>
+void checkMergedHull(const std::vector<Point<T>> &points, const std::vector<int> &hull_indices,
+                     const std::vector<Point<T>> &expected, Orientation orientation, ConvexHullReturnType return_type)
+{
+    if (expected.empty())
+    {
+        CHECK(hull_indices.empty());
+        return;
+    }
+    checkHull(points, hull_indices, expected, orientation, return_type, true);
+}
+
+/// @brief Checks merges of the hulls of k sets of points, which may share points, against the brute-force hull of
+/// their vertices. The hulls alternate orientation and return type, and the merge tree is checked as leaves of it are
+/// replaced.
+template <typename T>
+void checkMergedHulls(const std::string &name, std::vector<Point<T>> points, const std::vector<int> &offsets,
+                      std::mt19937 &generator)
+{
+    const int k = static_cast<int>(offsets.size()) - 1;
+    const auto getSetHull = [&](int first, int last, int set_no) {
+        std::vector<int> set_indices(last - first);
+        std::iota(set_indices.begin(), set_indices.end(), first);
+        const auto orientation = (set_no % 2 == 0) ? Orientation::COUNTERCLOCKWISE : Orientation::CLOCKWISE;
+        const auto return_type = (set_no % 3 == 0) ? ConvexHullReturnType::ENCLOSED : ConvexHullReturnType::OPEN;
+        std::vector<Point<T>> set_points(points.begin() + first, points.begin() + last);
+        auto hull = constructConvexHull(set_points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN, orientation,
+                                        return_type);
+        for (auto &index : hull)
+        {
+            index = set_indices[index];
+        }
+        return hull;
+    };
+
+    std::vector<std::vector<int>> hulls;
+    std::vector<int> hull_indices, hull_offsets{0};
+    for (int set_no = 0; set_no < k; ++set_no)
+    {
+        hulls.push_back(getSetHull(offsets[set_no], offsets[set_no + 1], set_no));
+        hull_indices.insert(hull_indices.end(), hulls.back().begin(), hulls.back().end());
+        hull_offsets.push_back(static_cast<int>(hull_indices.size()));
+    }
+    auto expected = getMergedHullVertices(points, hulls);
+
+    ConvexHullWorkspace<T> workspace;
+    std::vector<int> merged_hull_indices;
+    for (const auto orientation : {Orientation::COUNTERCLOCKWISE, Orientation::CLOCKWISE})
+    {
+        for (const auto return_type : {ConvexHullReturnType::OPEN, ConvexHullReturnType::ENCLOSED})
+        {
+            test_context = "merge " + name + " k=" + std::to_string(k);
+            checkMergedHull(points, mergeConvexHulls(points, hull_indices, hull_offsets, orientation, return_type),
+                            expected, orientation, return_type);
+            mergeConvexHulls(points, hulls, merged_hull_indices, workspace, orientation, return_type);
+            checkMergedHull(points, merged_hull_indices, expected, orientation, return_type);
+        }
+    }
+
+    // Trees of several fan-outs, whose leaves are then replaced by hulls of new points one at a time
+    for (const int fan_out : {2, 3, 4})
+    {
+        test_context = "merge tree " + name + " k=" + std::to_string(k) + " fan-out " + std::to_string(fan_out);
+        ConvexHullMergeTree<T> tree(k, fan_out);
+        CHECK(tree.setLeafHulls(points, hull_indices, hull_offsets));
+        CHECK(tree.getNumberOfLevels() >= 2);
+        checkMergedHull(points, tree.getHullIndices(), expected, Orientation::COUNTERCLOCKWISE,
+                        ConvexHullReturnType::OPEN);
+
+        auto leaf_hulls = hulls;
+        std::uniform_int_distribution<int> leaf(0, k - 1);
+        for (int update = 0; update < 4; ++update)
+        {
+            const int leaf_no = leaf(generator);
+            const int first = static_cast<int>(points.size());
+            const int size = offsets[leaf_no + 1] - offsets[leaf_no];
+            for (int i = 0; i < size; ++i)
+            {
+                const auto &point = points[offsets[leaf_no] + i];
+                points.emplace_back(point.y, point.x + T(update + 1));
+            }
+            leaf_hulls[leaf_no] = getSetHull(first, first + size, update);
+            CHECK(tree.setLeafHull(points, leaf_no, leaf_hulls[leaf_no]));
+            checkMergedHull(points, tree.getHullIndices(Orientation::CLOCKWISE, ConvexHullReturnType::ENCLOSED),
+                            getMergedHullVertices(points, leaf_hulls), Orientation::CLOCKWISE,
+                            ConvexHullReturnType::ENCLOSED);
+        }
+
+        // Invalid updates leave the tree unchanged
+        const auto hull_before = tree.getHullIndices();
+        CHECK(!tree.setLeafHull(points, k, hulls[0]));
+        CHECK(!tree.setLeafHull(points, -1, hulls[0]));
+        CHECK(!tree.setLeafHulls(points, hull_indices, {0}));
+        CHECK(tree.getHullIndices() == hull_before);
+    }
+}
+
+/// @brief Checks merged hulls of random, grid, collinear and coinciding point sets in several numbers of sets
+void testMergedHulls()
+{
+    std::mt19937 generator(41);
+    std::uniform_real_distribution<double> unit(-1, 1);
+    std::uniform_int_distribution<int> grid_coordinate(0, 6);
+    for (const int k : {1, 2, 3, 5, 16})
+    {
+        // Sets of 1 to 9 points, so that sets of fewer than 3 points contribute no hull
+        std::vector<int> offsets{0};
+        for (int set_no = 0; set_no < k; ++set_no)
+        {
+            offsets.push_back(offsets.back() + 1 + static_cast<int>(generator() % 9));
+        }
+        const int n = offsets.back();
+
+        std::vector<Point<double>> disk;
+        std::vector<Point<float>> circle;
+        std::vector<Point<int>> grid, line;
+        std::vector<Point<std::int64_t>> wide;
+        while (static_cast<int>(disk.size()) < n)
+        {
+            const Point<double> point(unit(generator), unit(generator));
+            if (point.x * point.x + point.y * point.y <= 1)
+            {
+                disk.push_back(point);
+                const double length = std::sqrt(point.x * point.x + point.y * point.y);
+                circle.emplace_back(static_cast<float>(point.x / length), static_cast<float>(point.y / length));
+                grid.emplace_back(grid_coordinate(generator), grid_coordinate(generator));
+                const int t = grid_coordinate(generator);
+                line.emplace_back(2 * t - 3, 5 - t);
+                wide.emplace_back(std::int64_t(grid.back().x) << 59, std::int64_t(grid.back().y) << 59);
+            }
+        }
+        checkMergedHulls("disk", disk, offsets, generator);
+        checkMergedHulls("circle", circle, offsets, generator);
+        checkMergedHulls("integer grid", grid, offsets, generator);
+        checkMergedHulls("collinear", line, offsets, generator);
+        checkMergedHulls("int64 grid", wide, offsets, generator);
+        checkMergedHulls("coinciding", std::vector<Point<double>>(n, Point<double>(1.5, -2)), offsets, generator);
+    }
+
+    // Hulls that were computed separately from overlapping sets of the same points
+    test_context = "merge overlapping sets";
+    std::vector<Point<double>> points;
+    for (int i = 0; i < 2000; ++i)
+    {
+        points.emplace_back(unit(generator), unit(generator));
+    }
+    std::vector<std::vector<int>> hulls;
+    std::vector<int> all_indices(points.size());
+    std::iota(all_indices.begin(), all_indices.end(), 0);
+    for (int first = 0; first + 500 <= 2000; first += 250)
+    {
+        const std::vector<Point<double>> set_points(points.begin() + first, points.begin() + first + 500);
+        auto hull = constructConvexHull(set_points, ConvexHullAlgorithm::QUICKHULL);
+        for (auto &index : hull)
+        {
+            index += first;
+        }
+        hulls.push_back(hull);
+    }
+    checkHull(points, mergeConvexHulls(points, hulls), getMergedHullVertices(points, hulls),
+              Orientation::COUNTERCLOCKWISE, ConvexHullReturnType::OPEN);
+    const auto expected = constructConvexHull(points, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN);
+    CHECK(mergeConvexHulls(points, hulls) == expected);
+
+    // No hulls, and a tree without leaves, have an empty hull
+    test_context = "merge empty";
+    CHECK(mergeConvexHulls(points, std::vector<std::vector<int>>{}).empty());
+    CHECK(mergeConvexHulls(points, std::vector<int>{}, std::vector<int>{}).empty());
+    ConvexHullMergeTree<double> empty_tree;
+    CHECK(empty_tree.getHullIndices().empty());
+}
+
+/// @brief Checks that every task of repeated task sets runs once, where tasks wait for tasks of smaller number, and
+/// that task sets started by tasks of the pool run serially
+void testThreadPool()
+{
+    ConvexHullThreadPool thread_pool;
+    for (const int number_of_threads : {2, 4, 3, 8})
+    {
+        constexpr int number_of_tasks = 500;
+        std::vector<std::atomic<int>> runs(number_of_tasks);
+        std::vector<char> task_done;
+        ConvexHullTaskDependencies dependencies(task_done, number_of_tasks);
+        runParallelTasks(thread_pool, number_of_tasks, number_of_threads, [&](int task_no) {
+            if (task_no > 0)
+            {
+                dependencies.waitUntilDone(task_no / 2);
+            }
+            int nested_runs = 0;
+            runParallelTasks(thread_pool, 3, number_of_threads, [&](int) { ++nested_runs; });
+            runs[task_no] += nested_runs;
+            dependencies.setDone(task_no);
+        });
+
+        test_context = "thread pool with " + std::to_string(number_of_threads) + " threads";
+        CHECK(std::all_of(runs.begin(), runs.end(), [](const std::atomic<int> &task_runs) { return task_runs == 3; }));
+    }
+}
+
+// Integer coordinates are exact over the whole int32 range and for int64 magnitudes below 2^62
+static_assert(isExactCoordinate(std::numeric_limits<std::int32_t>::max()) &&
+                  isExactCoordinate(std::numeric_limits<std::int32_t>::min()),
+              "int32 coordinates must be exact over their whole range");
+static_assert(isExactCoordinate((std::int64_t(1) << 62) - 1) && !isExactCoordinate(std::int64_t(1) << 62) &&
+                  !isExactCoordinate(-(std::int64_t(1) << 62)),
+              "int64 coordinates must be exact below magnitude 2^62");
+
+// Fixed-size hulls are computed during constant evaluation, with exact predicates for floating-point coordinates: the
+// rounded cross product of the last three points is 0, while the first one lies 2^-53 to the right of the line
+constexpr std::array<Point<int>, 5> fixed_square = {{{0, 0}, {2, 0}, {1, 1}, {2, 2}, {0, 2}}};
+constexpr auto fixed_square_hull = constructConvexHull(fixed_square);
+static_assert(fixed_square_hull.size() == 4 && fixed_square_hull[0] == 0 && fixed_square_hull[1] == 1 &&
+                  fixed_square_hull[2] == 3 && fixed_square_hull[3] == 4,
+              "fixed-size hulls of integer points must be computed at compile time");
+constexpr std::array<Point<double>, 3> fixed_nearly_collinear = {{{0.5 + 0x1p-53, 0.5}, {12, 12}, {24, 24}}};
+constexpr auto fixed_nearly_collinear_hull = constructConvexHull(fixed_nearly_collinear);
+static_assert(fixed_nearly_collinear_hull.size() == 3 && fixed_nearly_collinear_hull[0] == 0 &&
+                  fixed_nearly_collinear_hull[1] == 2 && fixed_nearly_collinear_hull[2] == 1,
+              "fixed-size hulls of floating-point points must use exact predicates at compile time");
+} // namespace
+
+int main()
+{
+    testDegenerateInputs();
+    testSlidingWindow();
+    testPresortedInputs();
+    testMelkman();
+    testNearlyCollinearPoints();
+    testIntegerLimits<std::int32_t>(std::numeric_limits<std::int32_t>::max());
+    testIntegerLimits<std::int64_t>((std::int64_t(1) << 62) - 1);
+    testLargeInputs();
+    testRadixSort<double>({-0.0, 0.0, -1.5, 2.25, 1e-310, -1e15, 1e15, 3.0, 7.0, 7.5});
+    testRadixSort<float>({-0.0f, 0.0f, -1.5f, 2.25f, 1e-40f, -1e7f, 1e7f, 3.0f, 7.0f, 7.5f});
+    testRadixSort<std::int32_t>({std::numeric_limits<std::int32_t>::min(), -7, -1, 0, 1, 2, 3, 5, 8,
+                                 std::numeric_limits<std::int32_t>::max()});
+    testRadixSort<std::int64_t>({-(std::int64_t(1) << 61), -7, -1, 0, 1, 2, 3, 5, 8, std::int64_t(1) << 61});
+    testBatchedSets();
+    testStreamingFile();
+    testConvexHull3();
+    testAutoSelection();
+    testConvexPolygon();
+    testHullGeometry();
+    testApproximateHull();
+    testFixedSizeSets();
+    testMergedHulls();
+    testThreadPool();
+
+    if (number_of_failures > 0)
+    {
+        std::cerr << number_of_failures << " checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}
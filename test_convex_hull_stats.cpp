@@ -0,0 +1,192 @@
+#define CONVEX_HULL_ENABLE_STATS
+#include "convex_hull.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Checks the stats collected with CONVEX_HULL_ENABLE_STATS defined. Returns the number of failed checks, so that ctest
+// reports failures.
+
+namespace
+{
+using namespace geom;
+
+int number_of_failures = 0;
+std::string test_context;
+
+void check(bool condition, const char *expression, const char *file, int line)
+{
+    if (!condition)
+    {
+        if (++number_of_failures <= 20)
+        {
+            std::cerr << file << ":" << line << ": check failed: " << expression << " [" << test_context << "]"
+                      << std::endl;
+        }
+    }
+}
+
+#define CHECK(condition) check((condition), #condition, __FILE__, __LINE__)
+
+std::vector<Point<double>> generateUniformPoints(int n)
+{
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> unit(-1, 1);
+    std::vector<Point<double>> points;
+    for (int i = 0; i < n; ++i)
+    {
+        points.emplace_back(unit(generator), unit(generator));
+    }
+    return points;
+}
+
+/// @brief Checks that stats describe the last construction, and that reusing the workspace and output vector makes no
+/// allocations
+void testConstructionStats()
+{
+    const auto points = generateUniformPoints(10000);
+    for (const auto algorithm : {ConvexHullAlgorithm::GRAHAM_SCAN, ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN,
+                                 ConvexHullAlgorithm::JARVIS_MARCH, ConvexHullAlgorithm::CHAN,
+                                 ConvexHullAlgorithm::QUICKHULL})
+    {
+        for (const auto filter : {ConvexHullFilter::NONE, ConvexHullFilter::OCTAGON})
+        {
+            test_context = "algorithm " + std::to_string(static_cast<int>(algorithm)) + ", filter " +
+                           std::to_string(static_cast<int>(filter));
+            ConvexHullStats stats;
+            ConvexHullWorkspace<double> workspace;
+            workspace.stats = &stats;
+            std::vector<int> hull_indices;
+            constructConvexHull(points, hull_indices, workspace, algorithm, Orientation::COUNTERCLOCKWISE,
+                                ConvexHullReturnType::OPEN, filter);
+            CHECK(stats.algorithm == algorithm);
+            CHECK(stats.number_of_points == static_cast<long long>(points.size()));
+            CHECK(stats.hull_size == static_cast<long long>(hull_indices.size()));
+            CHECK(stats.number_of_orientation_tests > 0);
+            CHECK(stats.number_of_allocations > 0);
+            CHECK((stats.number_of_filtered_points > 0) == (filter != ConvexHullFilter::NONE));
+
+            double stage_seconds = 0;
+            for (int stage = 0; stage < ConvexHullStats::number_of_stages; ++stage)
+            {
+                CHECK(stats.stage_seconds[stage] >= 0);
+                stage_seconds += stats.stage_seconds[stage];
+            }
+            CHECK(stage_seconds <= stats.total_seconds * (1 + 1e-9));
+
+            const long long number_of_orientation_tests = stats.number_of_orientation_tests;
+            constructConvexHull(points, hull_indices, workspace, algorithm, Orientation::COUNTERCLOCKWISE,
+                                ConvexHullReturnType::OPEN, filter);
+            CHECK(stats.number_of_allocations == 0);
+            CHECK(stats.number_of_orientation_tests == number_of_orientation_tests);
+        }
+    }
+
+    // AUTO reports the algorithm it selected
+    test_context = "AUTO";
+    ConvexHullStats stats;
+    ConvexHullWorkspace<double> auto_workspace;
+    auto_workspace.stats = &stats;
+    std::vector<int> auto_hull_indices;
+    constructConvexHull(points, auto_hull_indices, auto_workspace, ConvexHullAlgorithm::AUTO);
+    CHECK(stats.algorithm == selectConvexHullAlgorithm(points).algorithm);
+    CHECK(stats.getSeconds(ConvexHullStage::SELECTION) > 0);
+
+    // Without stats the workspace is used as before
+    ConvexHullWorkspace<double> workspace;
+    std::vector<int> hull_indices;
+    constructConvexHull(points, hull_indices, workspace, ConvexHullAlgorithm::QUICKHULL);
+    CHECK(!hull_indices.empty());
+}
+
+/// @brief Checks that parallel algorithms report the serial algorithm they fall back to for small inputs, and that
+/// counters include the work of pool workers
+void testParallelStats()
+{
+    ConvexHullThreadPool thread_pool;
+    ConvexHullStats stats;
+    ConvexHullWorkspace<double> workspace;
+    workspace.stats = &stats;
+    workspace.thread_pool = &thread_pool;
+    std::vector<int> hull_indices;
+
+    test_context = "parallel fallback";
+    const auto small_points = generateUniformPoints(100);
+    constructParallelAndrewMonotoneChainConvexHull(small_points, Orientation::COUNTERCLOCKWISE,
+                                                   ConvexHullReturnType::OPEN, workspace, hull_indices, 4);
+    CHECK(stats.algorithm == ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN);
+    constructQuickhullConvexHull(small_points, Orientation::COUNTERCLOCKWISE, ConvexHullReturnType::OPEN, workspace,
+                                 hull_indices, 4);
+    CHECK(stats.algorithm == ConvexHullAlgorithm::PARALLEL_QUICKHULL ||
+          stats.algorithm == ConvexHullAlgorithm::QUICKHULL);
+    CHECK(stats.hull_size == static_cast<long long>(hull_indices.size()));
+
+    // The first task waits until the second one has started, which therefore runs on a worker of the pool
+    test_context = "worker counters";
+    {
+        ConvexHullStatsScope<double> stats_scope(workspace, hull_indices, ConvexHullAlgorithm::QUICKHULL, 0);
+        std::atomic<bool> is_second_task_started{false};
+        runParallelTasks(thread_pool, 8, 4, [&](int task_no) {
+            if (task_no == 1)
+            {
+                is_second_task_started = true;
+            }
+            while (task_no == 0 && !is_second_task_started)
+            {
+                std::this_thread::yield();
+            }
+            CONVEX_HULL_COUNT(number_of_hull_pops, 1);
+        });
+    }
+    CHECK(stats.number_of_hull_pops == 8);
+
+    // Every set is hulled the same way whichever thread runs it, so counters do not depend on the number of threads
+    const auto points = generateUniformPoints(40000);
+    std::vector<int> offsets;
+    for (int offset = 0; offset < static_cast<int>(points.size()); offset += 1 + offset % 97)
+    {
+        offsets.push_back(offset);
+    }
+    offsets.push_back(static_cast<int>(points.size()));
+    std::vector<int> hull_offsets;
+    ConvexHullStats serial_stats;
+    for (const int number_of_threads : {1, 4})
+    {
+        test_context = "batched sets with " + std::to_string(number_of_threads) + " threads";
+        constructConvexHulls(points, offsets, hull_indices, hull_offsets, workspace, Orientation::COUNTERCLOCKWISE,
+                             ConvexHullReturnType::OPEN, number_of_threads);
+        CHECK(stats.algorithm == ConvexHullAlgorithm::ANDREW_MONOTONE_CHAIN);
+        CHECK(stats.hull_size == static_cast<long long>(hull_indices.size()));
+        CHECK(stats.number_of_filtered_points > 0);
+        if (number_of_threads == 1)
+        {
+            serial_stats = stats;
+        }
+        else
+        {
+            CHECK(stats.number_of_orientation_tests == serial_stats.number_of_orientation_tests);
+            CHECK(stats.number_of_hull_pops == serial_stats.number_of_hull_pops);
+            CHECK(stats.number_of_filtered_points == serial_stats.number_of_filtered_points);
+        }
+    }
+}
+} // namespace
+
+int main()
+{
+    testConstructionStats();
+    testParallelStats();
+
+    if (number_of_failures > 0)
+    {
+        std::cerr << number_of_failures << " checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}